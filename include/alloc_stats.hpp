@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+
+namespace aoc2025::alloc {
+    struct Stats {
+        std::uint64_t count = 0;      // allocations made
+        std::uint64_t bytes = 0;      // bytes requested
+        std::uint64_t peak_live = 0;  // high-water mark of live bytes above the starting point
+    };
+
+    // True when the build replaces global operator new/delete
+    // (CMake option AOC2025_ALLOC_STATS); otherwise every Scope reads zero
+    bool tracking_compiled();
+
+    // Allocations made by the calling thread between construction and stop().
+    // Memory freed by another thread is credited to that thread, so peak_live
+    // is exact for work that stays on one thread, as each part does. Scopes
+    // nest: an inner one hands its peak on to the enclosing one when it ends.
+    class Scope {
+        std::uint64_t start_count_;
+        std::uint64_t start_bytes_;
+        std::int64_t start_live_;
+        std::int64_t saved_peak_;
+
+    public:
+        Scope();
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        Stats stop() const;
+    };
+
+    // Peak resident set size of the whole process so far, 0 where unknown
+    std::uint64_t peak_rss_bytes();
+
+    // "1234 allocations, 56.7 KB, peak live 12.3 KB"
+    void print_stats(std::ostream& os, const Stats& stats);
+    void print_bytes(std::ostream& os, std::uint64_t bytes);
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace aoc2025 {
+#ifdef __SIZEOF_INT128__
+    #define AOC2025_HAVE_INT128 1
+    __extension__ typedef __int128 Int128;
+#endif
+
+    // Result of one part, kept typed until it reaches the output edge so it can
+    // be compared, summed and cached without formatting through iostreams.
+    // Integers that fit in 64 bits are always stored as int64, so equal values
+    // compare equal regardless of how they were produced.
+    class Answer {
+    public:
+#ifdef AOC2025_HAVE_INT128
+        using Value = std::variant<std::int64_t, Int128, std::string>;
+#else
+        using Value = std::variant<std::int64_t, std::string>;
+#endif
+
+    private:
+        Value value_ = std::int64_t{0};
+
+    public:
+        Answer() = default;
+
+        template <std::integral T>
+            requires (!std::is_same_v<T, bool>)
+        Answer(T number) {
+            if constexpr (std::is_unsigned_v<T> && sizeof(T) >= sizeof(std::int64_t)) {
+                if (number > static_cast<T>(std::numeric_limits<std::int64_t>::max())) {
+#ifdef AOC2025_HAVE_INT128
+                    value_ = static_cast<Int128>(number);
+#else
+                    value_ = std::to_string(number);
+#endif
+                    return;
+                }
+            }
+            value_ = static_cast<std::int64_t>(number);
+        }
+
+#ifdef AOC2025_HAVE_INT128
+        Answer(Int128 number) {
+            if (number >= std::numeric_limits<std::int64_t>::min() &&
+                number <= std::numeric_limits<std::int64_t>::max()) {
+                value_ = static_cast<std::int64_t>(number);
+            } else {
+                value_ = number;
+            }
+        }
+#endif
+
+        Answer(std::string text) : value_(std::move(text)) {}
+        Answer(const char* text) : value_(std::string(text)) {}
+
+        const Value& value() const { return value_; }
+
+        bool is_integer() const { return !std::holds_alternative<std::string>(value_); }
+
+        // The answer as int64; throws std::out_of_range for wider or text answers
+        std::int64_t as_int64() const {
+            if (const auto* number = std::get_if<std::int64_t>(&value_)) {
+                return *number;
+            }
+            throw std::out_of_range("Answer is not a 64-bit integer: " + to_string());
+        }
+
+        std::string to_string() const {
+            if (const auto* number = std::get_if<std::int64_t>(&value_)) {
+                return std::to_string(*number);
+            }
+#ifdef AOC2025_HAVE_INT128
+            if (const auto* wide = std::get_if<Int128>(&value_)) {
+                const bool negative = *wide < 0;
+                // Work in negatives so the minimum value does not overflow
+                Int128 rest = negative ? *wide : -*wide;
+                std::string digits;
+                do {
+                    digits.insert(digits.begin(), static_cast<char>('0' - static_cast<int>(rest % 10)));
+                    rest /= 10;
+                } while (rest != 0);
+                return negative ? "-" + digits : digits;
+            }
+#endif
+            return std::get<std::string>(value_);
+        }
+
+        // Inverse of to_string: integers come back as integers, anything else as text
+        static Answer parse(std::string_view text) {
+            std::int64_t number = 0;
+            const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), number);
+            if (ec == std::errc() && end == text.data() + text.size() && !text.empty()) {
+                return Answer(number);
+            }
+#ifdef AOC2025_HAVE_INT128
+            const bool negative = !text.empty() && text.front() == '-';
+            const std::string_view digits = negative ? text.substr(1) : text;
+            if (!digits.empty() && digits.size() <= 38 &&
+                digits.find_first_not_of("0123456789") == std::string_view::npos) {
+                Int128 wide = 0;
+                for (const char ch : digits) {
+                    wide = wide * 10 + (ch - '0');
+                }
+                return Answer(negative ? -wide : wide);
+            }
+#endif
+            return Answer(std::string(text));
+        }
+
+        friend bool operator==(const Answer&, const Answer&) = default;
+
+        // Integer sum, widening to 128 bits where available; text answers cannot be summed
+        friend Answer operator+(const Answer& lhs, const Answer& rhs) {
+            if (!lhs.is_integer() || !rhs.is_integer()) {
+                throw std::invalid_argument("Cannot add text answers");
+            }
+#ifdef AOC2025_HAVE_INT128
+            auto widen = [](const Value& value) {
+                return std::visit([](const auto& v) -> Int128 {
+                    if constexpr (std::is_same_v<std::decay_t<decltype(v)>, std::string>) {
+                        return 0;
+                    } else {
+                        return static_cast<Int128>(v);
+                    }
+                }, value);
+            };
+            return Answer(widen(lhs.value_) + widen(rhs.value_));
+#else
+            const std::int64_t a = lhs.as_int64();
+            const std::int64_t b = rhs.as_int64();
+            if ((b > 0 && a > std::numeric_limits<std::int64_t>::max() - b) ||
+                (b < 0 && a < std::numeric_limits<std::int64_t>::min() - b)) {
+                throw std::overflow_error("Answer sum overflows 64 bits");
+            }
+            return Answer(a + b);
+#endif
+        }
+
+        Answer& operator+=(const Answer& other) {
+            return *this = *this + other;
+        }
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, const Answer& answer) {
+        if (const auto* number = std::get_if<std::int64_t>(&answer.value())) {
+            return os << *number;
+        }
+        return os << answer.to_string();
+    }
+}
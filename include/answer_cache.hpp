@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace aoc2025 {
+    enum class CacheMode {
+        kUse,     // return stored answers, store new ones
+        kBypass,  // neither read nor write the cache
+        kVerify   // always solve, report and replace stored answers that differ
+    };
+
+    struct CacheKey {
+        int day_number;
+        int part;
+        std::string solver_version;
+        std::uint64_t input_hash;
+        std::uint64_t input_size;
+
+        // Stable file name, e.g. "day3-part2-v1-1a2b3c4d5e6f7081-20480"
+        std::string file_name() const;
+    };
+
+    // On-disk answer store, one small file per key. Entries are written to a
+    // unique temporary file and renamed into place, so concurrent runner
+    // processes sharing a directory only ever see complete answers.
+    class AnswerCache {
+        std::filesystem::path directory_;
+
+    public:
+        explicit AnswerCache(std::filesystem::path directory) : directory_(std::move(directory)) {}
+
+        const std::filesystem::path& directory() const { return directory_; }
+
+        std::optional<std::string> load(const CacheKey& key) const;
+
+        // Best effort: a cache that cannot be written is reported, never fatal
+        bool store(const CacheKey& key, std::string_view answer) const;
+    };
+}
@@ -2,26 +2,158 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <ostream>
 #include <iostream>
-#include <fstream>
 #include <filesystem>
 #include <sstream>
 #include <map>
 #include <optional>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+
+#include "answer.hpp"
+#include "binary.hpp"
+#include "compression.hpp"
+#include "incremental.hpp"
+#include "input.hpp"
+#include "stream.hpp"
 
 namespace aoc2025 {
     struct Day {
         int day_number;
         std::string title;
         
-        using PartFunction = std::ostream&(*)(std::ostream&, const std::string&);
+        using PartFunction = std::ostream&(*)(std::ostream&, std::string_view);
         PartFunction part1;
         std::optional<PartFunction> part2; // Optional for unlocked parts
+
+        // Bump whenever a change alters answers, so cached results are not reused
+        std::string version = "1";
+
+        // Typed solvers; when set they are preferred over the ostream adaptors
+        using AnswerFunction = Answer(*)(std::string_view);
+        AnswerFunction answer1 = nullptr;
+        AnswerFunction answer2 = nullptr;
+
+        // Optional shared parse stage: parse builds a type-erased model once per
+        // input, allocating from the given memory resource, and model1/model2
+        // solve from it, so both parts share the parsing. See
+        // make_model/solve_model below for the typed adaptors.
+        using Model = std::shared_ptr<const void>;
+        using ParseFunction = Model(*)(std::string_view, std::pmr::memory_resource*);
+        using ModelFunction = Answer(*)(const void*);
+        ParseFunction parse = nullptr;
+        ModelFunction model1 = nullptr;
+        ModelFunction model2 = nullptr;
+
+        // Optional binary form of the parsed model, for the sidecar files of
+        // include/model_cache.hpp: save appends a model built by parse, load
+        // rebuilds it from those bytes into the given memory resource and
+        // throws std::runtime_error on malformed data. See save_model/load_model
+        // below for the typed adaptors.
+        using SaveFunction = void(*)(const void*, std::string&);
+        using LoadFunction = Model(*)(std::string_view, std::pmr::memory_resource*);
+        SaveFunction save = nullptr;
+        LoadFunction load = nullptr;
+
+        // Optional chunked solver for inputs that should not be held in memory
+        // whole; stream(part) returns a fresh solver for that part
+        using StreamFactory = std::unique_ptr<StreamSolver>(*)(int part);
+        StreamFactory stream = nullptr;
+
+        // Byte ending each independent record, for days whose answers are
+        // sums over records: the input may then be cut after any such byte,
+        // the pieces solved separately and their answers added (see
+        // include/coordinator.hpp). Zero for days whose records interact.
+        char shard_delimiter = '\0';
+
+        // Optional solver that keeps its model between versions of an input
+        // and re-solves only what an edit affects, for --watch
+        using IncrementalFactory = std::unique_ptr<IncrementalSolver>(*)();
+        IncrementalFactory incremental = nullptr;
+
+        bool has_part(int part) const {
+            return part == 1 || (part == 2 && part2.has_value());
+        }
+
+        bool has_parse_stage() const {
+            return parse != nullptr && model1 != nullptr && (model2 != nullptr || !part2.has_value());
+        }
+
+        bool has_binary_model() const {
+            return has_parse_stage() && save != nullptr && load != nullptr;
+        }
+
+        bool has_stream() const {
+            return stream != nullptr;
+        }
+
+        bool has_incremental() const {
+            return incremental != nullptr;
+        }
+
+        bool is_shardable() const {
+            return shard_delimiter != '\0';
+        }
+
+        // Parse into a monotonic arena owned by the returned model: every
+        // allocation of the parse is a pointer bump into memory sized from the
+        // input, and the whole model is released in one go with its last user
+        Model parse_model(std::string_view input) const {
+            return in_arena(input.size() + 4096, [&](std::pmr::memory_resource* resource) {
+                return parse(input, resource);
+            });
+        }
+
+        // Rebuild a model from bytes written by save, in an arena like parse_model
+        Model load_model(std::string_view bytes) const {
+            return in_arena(bytes.size() + 4096, [&](std::pmr::memory_resource* resource) {
+                return load(bytes, resource);
+            });
+        }
+
+        // Binary form of a model built by parse or load
+        std::string save_model(const Model& model) const {
+            std::string bytes;
+            save(model.get(), bytes);
+            return bytes;
+        }
+
+        // Solve one part from a model built by parse
+        Answer solve_parsed(int part, const Model& model) const {
+            return (part == 1 ? model1 : model2)(model.get());
+        }
+
+        // Solve one part, going through the ostream adaptor only for days
+        // without a typed solver
+        Answer solve(int part, std::string_view input) const {
+            if (has_parse_stage()) {
+                return solve_parsed(part, parse_model(input));
+            }
+            const AnswerFunction typed = part == 1 ? answer1 : answer2;
+            if (typed != nullptr) {
+                return typed(input);
+            }
+            std::ostringstream oss;
+            (part == 1 ? part1 : part2.value())(oss, input);
+            return Answer::parse(oss.str());
+        }
         
-        // Get input file path for this day
+        // Get input file path for this day: dayN/data.txt, or a compressed
+        // copy such as dayN/data.txt.gz when only that exists
         std::string get_input_file() const {
-            return "day" + std::to_string(day_number) + "/data.txt";
+            const std::string path = "day" + std::to_string(day_number) + "/data.txt";
+            if (!std::filesystem::exists(path)) {
+                for (const std::string_view suffix : compression::kFileSuffixes) {
+                    std::string compressed = path + std::string(suffix);
+                    if (std::filesystem::exists(compressed)) {
+                        return compressed;
+                    }
+                }
+            }
+            return path;
         }
         
         // Check if input file exists
@@ -29,18 +161,57 @@ namespace aoc2025 {
             return std::filesystem::exists(get_input_file());
         }
         
-        // Read input file content
-        std::string read_input() const {
-            std::ifstream file(get_input_file());
-            if (!file.is_open()) {
-                return "";
-            }
-            std::ostringstream oss;
-            oss << file.rdbuf();
-            return oss.str();
+        // Map the input file; throws std::runtime_error if it cannot be read
+        Input read_input() const {
+            return Input::open(get_input_file());
+        }
+
+    private:
+        template <typename Build>
+        static Model in_arena(std::size_t initial_size, Build build) {
+            struct Arena {
+                std::pmr::monotonic_buffer_resource resource;
+                Model model;
+
+                explicit Arena(std::size_t size) : resource(size) {}
+            };
+            auto arena = std::make_shared<Arena>(initial_size);
+            arena->model = build(&arena->resource);
+            return Model(arena, arena->model.get());
         }
     };
     
+    // Day::parse adaptor for a model type constructible from the input and a
+    // memory resource; the model itself is allocated from the resource too
+    template <typename Model>
+    Day::Model make_model(std::string_view input, std::pmr::memory_resource* resource) {
+        return std::allocate_shared<Model>(std::pmr::polymorphic_allocator<Model>(resource), input, resource);
+    }
+
+    // Day::save adaptor for a model type with save(std::string&)
+    template <typename Model>
+    void save_model(const void* model, std::string& out) {
+        static_cast<const Model*>(model)->save(out);
+    }
+
+    // Day::load adaptor for a model type constructible from a binary::Reader
+    // and a memory resource; rejects bytes left over after the model
+    template <typename Model>
+    Day::Model load_model(std::string_view bytes, std::pmr::memory_resource* resource) {
+        binary::Reader reader(bytes);
+        auto model = std::allocate_shared<Model>(std::pmr::polymorphic_allocator<Model>(resource), reader, resource);
+        if (!reader.at_end()) {
+            throw std::runtime_error("Trailing bytes after binary model");
+        }
+        return model;
+    }
+
+    // Day::model1/model2 adaptor for a solver taking the concrete model type
+    template <typename Model, Answer (*Solve)(const Model&)>
+    Answer solve_model(const void* model) {
+        return Solve(*static_cast<const Model*>(model));
+    }
+
     extern std::map<int, Day> days;
     
     // Register a day
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "answer.hpp"
+#include "thread_pool.hpp"
+
+namespace aoc2025 {
+    // One input file to solve for one day
+    struct BatchItem {
+        int day_number = 0;
+        std::filesystem::path path;
+    };
+
+    struct BatchResult {
+        BatchItem item;
+        std::uint64_t bytes = 0;
+        std::optional<Answer> part1;
+        std::optional<Answer> part2;
+        double solve_ms = 0.0;
+        std::string error;
+    };
+
+    enum class BatchFormat {
+        kCsv,
+        kJson
+    };
+
+    struct BatchOptions {
+        // Directories (every regular file below them) and manifest files.
+        // Manifest lines are "PATH" or "DAY PATH", '#' starts a comment, and
+        // relative paths are resolved against the manifest's directory.
+        std::vector<std::filesystem::path> sources;
+
+        // Days to solve each file for; when empty the day is taken from a
+        // "dayN" component of the file's path, e.g. inputs/alice/day3.txt
+        std::vector<int> days;
+
+        unsigned threads = ThreadPool::default_thread_count();
+
+        // Upper bound on input bytes loaded at once; a single larger file
+        // still runs, alone
+        std::size_t max_bytes_in_flight = std::size_t{256} << 20;
+
+        // Results file, "-" or empty for stdout
+        std::string output_path;
+        BatchFormat format = BatchFormat::kCsv;
+    };
+
+    // Expand sources into work items in a stable order; throws
+    // std::runtime_error for unreadable sources or malformed manifest lines
+    std::vector<BatchItem> collect_batch(const BatchOptions& options);
+
+    // Day number from a "dayN" path component or file stem, if any
+    std::optional<int> day_from_path(const std::filesystem::path& path);
+
+    // Solve every item across a thread pool; results come back in item order
+    std::vector<BatchResult> solve_batch(const std::vector<BatchItem>& items, const BatchOptions& options);
+
+    void write_batch_csv(std::ostream& out, const std::vector<BatchResult>& results);
+    void write_batch_json(std::ostream& out, const std::vector<BatchResult>& results, double seconds);
+
+    // Collect, solve, write results and report throughput to err
+    int run_batch(const BatchOptions& options, std::ostream& out, std::ostream& err);
+}
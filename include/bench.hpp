@@ -0,0 +1,166 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "size.hpp"
+
+namespace aoc2025::bench {
+    // A kernel runs the measured work once and returns a checksum so the
+    // compiler cannot discard the result
+    using Kernel = std::function<std::uint64_t()>;
+
+    // Build the (untimed) state for one input size and return the kernel to measure
+    using SetupFunction = std::function<Kernel(std::size_t input_bytes, std::uint64_t seed)>;
+
+    struct Benchmark {
+        std::string name;
+        SetupFunction setup;
+    };
+
+    // All benchmarks linked into the binary, in registration order
+    inline std::vector<Benchmark>& benchmarks() {
+        static std::vector<Benchmark> registry;
+        return registry;
+    }
+
+    // Registers a benchmark from a static initializer in a day*_bench.cpp file
+    struct Registrar {
+        Registrar(std::string name, SetupFunction setup) {
+            benchmarks().push_back(Benchmark{std::move(name), std::move(setup)});
+        }
+    };
+
+    // Sizes from min_bytes up to max_bytes, each factor times the last,
+    // stopping before a step would overflow
+    inline std::vector<std::size_t> sweep_sizes(std::size_t min_bytes, std::size_t max_bytes, std::size_t factor) {
+        std::vector<std::size_t> sizes;
+        for (std::size_t bytes = min_bytes; bytes > 0 && bytes <= max_bytes;) {
+            sizes.push_back(bytes);
+            if (factor < 2 || bytes > max_bytes / factor) {
+                break;
+            }
+            bytes *= factor;
+        }
+        return sizes;
+    }
+
+    // Median time and allocations per run of one benchmark at one input
+    // size, as recorded in a baseline file
+    struct BaselineEntry {
+        std::string name;
+        std::size_t bytes = 0;
+        double median_ns = 0.0;
+        std::uint64_t allocations = 0;
+    };
+
+    // Fixed kernel measured alongside the benchmarks. Baseline times are
+    // scaled by how fast it runs now compared with when they were recorded,
+    // so a baseline taken on one machine can be checked on another.
+    inline constexpr const char* kCalibration = "calibration";
+
+    // One "name size median_ns allocations" line per entry; blank lines and
+    // lines starting with '#' are skipped. Throws std::runtime_error naming
+    // the first malformed line.
+    inline std::vector<BaselineEntry> parse_baseline(std::istream& in) {
+        std::vector<BaselineEntry> entries;
+        std::string line;
+        for (int number = 1; std::getline(in, line); ++number) {
+            const std::size_t first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#') {
+                continue;
+            }
+            std::istringstream fields(line);
+            BaselineEntry entry;
+            std::string size;
+            std::string rest;
+            if (!(fields >> entry.name >> size >> entry.median_ns >> entry.allocations) || (fields >> rest) ||
+                (entry.bytes = aoc2025::parse_size(size)) == 0 || entry.median_ns < 0.0) {
+                throw std::runtime_error("Malformed baseline line " + std::to_string(number) + ": " + line);
+            }
+            entries.push_back(std::move(entry));
+        }
+        return entries;
+    }
+
+    inline void write_baseline(std::ostream& out, const std::vector<BaselineEntry>& entries) {
+        out << "# Recorded by bench_runner --write-baseline, checked by bench_runner --baseline\n"
+            << "# name size median_ns allocations\n";
+        for (const BaselineEntry& entry : entries) {
+            out << entry.name << ' ' << aoc2025::format_size(entry.bytes) << ' ' << static_cast<std::uint64_t>(entry.median_ns)
+                << ' ' << entry.allocations << '\n';
+        }
+    }
+
+    struct Comparison {
+        std::string name;
+        std::size_t bytes = 0;
+        double median_ns = 0.0;
+        // Baseline median scaled to this machine, 0 when not in the baseline
+        double expected_ns = 0.0;
+        std::uint64_t allocations = 0;
+        std::uint64_t baseline_allocations = 0;
+        bool in_baseline = false;
+        bool slower = false;
+        bool more_allocations = false;
+
+        // Change of the median against the expected one, +0.25 for 25% slower
+        double change() const {
+            return expected_ns > 0.0 ? median_ns / expected_ns - 1.0 : 0.0;
+        }
+    };
+
+    // Compare measured entries with a baseline. A benchmark is slower when
+    // its median exceeds the scaled baseline by more than tolerance (0.25
+    // for 25%); allocations must not exceed the baseline at all unless
+    // check_allocations is false.
+    inline std::vector<Comparison> compare(const std::vector<BaselineEntry>& baseline,
+                                           const std::vector<BaselineEntry>& current, double tolerance,
+                                           bool check_allocations = true) {
+        auto find = [](const std::vector<BaselineEntry>& entries, const std::string& name,
+                       std::size_t bytes) -> const BaselineEntry* {
+            const auto it = std::find_if(entries.begin(), entries.end(), [&](const BaselineEntry& entry) {
+                return entry.name == name && entry.bytes == bytes;
+            });
+            return it == entries.end() ? nullptr : &*it;
+        };
+
+        double scale = 1.0;
+        const auto then = std::find_if(baseline.begin(), baseline.end(),
+                                       [](const BaselineEntry& entry) { return entry.name == kCalibration; });
+        const auto now = std::find_if(current.begin(), current.end(),
+                                      [](const BaselineEntry& entry) { return entry.name == kCalibration; });
+        if (then != baseline.end() && now != current.end() && then->median_ns > 0.0) {
+            scale = now->median_ns / then->median_ns;
+        }
+
+        std::vector<Comparison> comparisons;
+        for (const BaselineEntry& entry : current) {
+            if (entry.name == kCalibration) {
+                continue;
+            }
+            Comparison comparison;
+            comparison.name = entry.name;
+            comparison.bytes = entry.bytes;
+            comparison.median_ns = entry.median_ns;
+            comparison.allocations = entry.allocations;
+            if (const BaselineEntry* recorded = find(baseline, entry.name, entry.bytes)) {
+                comparison.in_baseline = true;
+                comparison.expected_ns = recorded->median_ns * scale;
+                comparison.baseline_allocations = recorded->allocations;
+                comparison.slower = comparison.change() > tolerance;
+                comparison.more_allocations = check_allocations && entry.allocations > recorded->allocations;
+            }
+            comparisons.push_back(std::move(comparison));
+        }
+        return comparisons;
+    }
+}
@@ -0,0 +1,396 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "generator.hpp"
+
+// Statistics for comparing two bench_runner runs: medians, a bootstrap
+// confidence interval on the speedup and a Mann-Whitney U test, so a change
+// is judged on every sample instead of a single timing
+namespace aoc2025::bench {
+    // Timed samples of one benchmark at one input size, as bench_runner --json writes them
+    struct SampleSet {
+        std::string name;
+        std::size_t bytes = 0;
+        std::vector<double> samples_ns;
+    };
+
+    namespace detail {
+        // Just enough JSON for bench_runner's output: any value can be
+        // skipped, so fields this reader does not know are ignored
+        class JsonReader {
+            std::string_view text_;
+            std::size_t at_ = 0;
+
+        public:
+            explicit JsonReader(std::string_view text) : text_(text) {}
+
+            [[noreturn]] void fail(const std::string& what) const {
+                throw std::runtime_error("Invalid JSON at byte " + std::to_string(at_) + ": " + what);
+            }
+
+            void skip_space() {
+                while (at_ < text_.size() && (text_[at_] == ' ' || text_[at_] == '\n' || text_[at_] == '\r' || text_[at_] == '\t')) {
+                    ++at_;
+                }
+            }
+
+            bool consume(char expected) {
+                skip_space();
+                if (at_ < text_.size() && text_[at_] == expected) {
+                    ++at_;
+                    return true;
+                }
+                return false;
+            }
+
+            void expect(char expected) {
+                if (!consume(expected)) {
+                    fail(std::string("expected '") + expected + "'");
+                }
+            }
+
+            bool at_end() {
+                skip_space();
+                return at_ == text_.size();
+            }
+
+            std::string string() {
+                expect('"');
+                std::string value;
+                while (at_ < text_.size() && text_[at_] != '"') {
+                    char c = text_[at_++];
+                    if (c == '\\') {
+                        if (at_ >= text_.size()) {
+                            break;
+                        }
+                        c = text_[at_++];
+                        switch (c) {
+                            case 'n': c = '\n'; break;
+                            case 't': c = '\t'; break;
+                            case 'r': c = '\r'; break;
+                            case 'b': c = '\b'; break;
+                            case 'f': c = '\f'; break;
+                            case 'u': fail("\\u escapes are not supported");
+                            default: break;
+                        }
+                    }
+                    value += c;
+                }
+                expect('"');
+                return value;
+            }
+
+            double number() {
+                skip_space();
+                const std::size_t start = at_;
+                while (at_ < text_.size() && std::string_view("+-.eE0123456789").find(text_[at_]) != std::string_view::npos) {
+                    ++at_;
+                }
+                const std::string digits(text_.substr(start, at_ - start));
+                std::size_t used = 0;
+                double value = 0.0;
+                try {
+                    value = std::stod(digits, &used);
+                } catch (const std::exception&) {
+                    used = 0;
+                }
+                if (digits.empty() || used != digits.size()) {
+                    at_ = start;
+                    fail("expected a number");
+                }
+                return value;
+            }
+
+            // Calls on_member(key) for every member; it must read the value
+            template <typename OnMember>
+            void object(OnMember&& on_member) {
+                expect('{');
+                if (consume('}')) {
+                    return;
+                }
+                do {
+                    const std::string key = string();
+                    expect(':');
+                    on_member(key);
+                } while (consume(','));
+                expect('}');
+            }
+
+            // Calls on_element() for every element; it must read the value
+            template <typename OnElement>
+            void array(OnElement&& on_element) {
+                expect('[');
+                if (consume(']')) {
+                    return;
+                }
+                do {
+                    on_element();
+                } while (consume(','));
+                expect(']');
+            }
+
+            void skip_value() {
+                skip_space();
+                if (at_ >= text_.size()) {
+                    fail("unexpected end");
+                }
+                switch (text_[at_]) {
+                    case '{': object([this](const std::string&) { skip_value(); }); return;
+                    case '[': array([this]() { skip_value(); }); return;
+                    case '"': string(); return;
+                    default: break;
+                }
+                for (const std::string_view word : {"true", "false", "null"}) {
+                    if (text_.substr(at_, word.size()) == word) {
+                        at_ += word.size();
+                        return;
+                    }
+                }
+                number();
+            }
+        };
+    }
+
+    // The results of a bench_runner --json file; throws std::runtime_error
+    // for malformed JSON or a result without a name or samples
+    inline std::vector<SampleSet> parse_results_json(std::string_view text) {
+        detail::JsonReader reader(text);
+        std::vector<SampleSet> results;
+        reader.object([&](const std::string& key) {
+            if (key != "results") {
+                reader.skip_value();
+                return;
+            }
+            reader.array([&]() {
+                SampleSet result;
+                reader.object([&](const std::string& field) {
+                    if (field == "name") {
+                        result.name = reader.string();
+                    } else if (field == "bytes") {
+                        result.bytes = static_cast<std::size_t>(reader.number());
+                    } else if (field == "samples_ns") {
+                        reader.array([&]() { result.samples_ns.push_back(reader.number()); });
+                    } else {
+                        reader.skip_value();
+                    }
+                });
+                if (result.name.empty() || result.samples_ns.empty()) {
+                    throw std::runtime_error("Benchmark result without a name or samples");
+                }
+                results.push_back(std::move(result));
+            });
+        });
+        if (!reader.at_end()) {
+            reader.fail("trailing characters");
+        }
+        return results;
+    }
+
+    inline double median(std::vector<double> values) {
+        if (values.empty()) {
+            return 0.0;
+        }
+        const std::size_t mid = values.size() / 2;
+        std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(mid), values.end());
+        const double upper = values[mid];
+        if (values.size() % 2 == 1) {
+            return upper;
+        }
+        return (*std::max_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(mid)) + upper) / 2.0;
+    }
+
+    struct MannWhitney {
+        double u = 0.0;  // U statistic of the first sample
+        double z = 0.0;
+        double p = 1.0;  // two-sided
+    };
+
+    // Mann-Whitney U test of whether one sample tends to be larger than the
+    // other, through the normal approximation with tie and continuity
+    // corrections. Makes no assumption about the shape of the timing
+    // distribution, which is skewed by outliers; needs about 8 samples a
+    // side to be accurate.
+    inline MannWhitney mann_whitney(const std::vector<double>& first, const std::vector<double>& second) {
+        const std::size_t n1 = first.size();
+        const std::size_t n2 = second.size();
+        MannWhitney result;
+        if (n1 == 0 || n2 == 0) {
+            return result;
+        }
+        std::vector<std::pair<double, bool>> pooled;
+        pooled.reserve(n1 + n2);
+        for (const double value : first) {
+            pooled.emplace_back(value, true);
+        }
+        for (const double value : second) {
+            pooled.emplace_back(value, false);
+        }
+        std::sort(pooled.begin(), pooled.end());
+
+        // Average ranks over runs of ties, and the tie correction term
+        double rank_sum = 0.0;
+        double ties = 0.0;
+        for (std::size_t i = 0; i < pooled.size();) {
+            std::size_t j = i;
+            while (j < pooled.size() && pooled[j].first == pooled[i].first) {
+                ++j;
+            }
+            const double rank = (static_cast<double>(i + 1) + static_cast<double>(j)) / 2.0;
+            for (std::size_t k = i; k < j; ++k) {
+                rank_sum += pooled[k].second ? rank : 0.0;
+            }
+            const double run = static_cast<double>(j - i);
+            ties += run * run * run - run;
+            i = j;
+        }
+
+        const double a = static_cast<double>(n1);
+        const double b = static_cast<double>(n2);
+        const double n = a + b;
+        result.u = rank_sum - a * (a + 1.0) / 2.0;
+        const double mean = a * b / 2.0;
+        const double variance = a * b / 12.0 * ((n + 1.0) - ties / (n * (n - 1.0)));
+        if (variance <= 0.0) {
+            return result;
+        }
+        const double distance = std::max(0.0, std::abs(result.u - mean) - 0.5);
+        result.z = (result.u > mean ? distance : -distance) / std::sqrt(variance);
+        result.p = std::min(1.0, std::erfc(std::abs(result.z) / std::sqrt(2.0)));
+        return result;
+    }
+
+    struct Interval {
+        double low = 0.0;
+        double high = 0.0;
+
+        bool contains(double value) const { return low <= value && value <= high; }
+    };
+
+    // Percentile bootstrap interval for median(before) / median(after): each
+    // resample draws both sides again with replacement. Seeded, so the same
+    // files always give the same interval.
+    inline Interval bootstrap_speedup(const std::vector<double>& before, const std::vector<double>& after,
+                                      double confidence = 0.95, int resamples = 10000, std::uint64_t seed = 2025) {
+        if (before.empty() || after.empty() || resamples <= 0) {
+            return {};
+        }
+        gen::Random rng(seed);
+        auto resampled_median = [&rng](const std::vector<double>& values, std::vector<double>& scratch) {
+            for (double& value : scratch) {
+                value = values[rng.between(0, values.size() - 1)];
+            }
+            return median(scratch);
+        };
+        std::vector<double> scratch_before(before.size());
+        std::vector<double> scratch_after(after.size());
+        std::vector<double> ratios;
+        ratios.reserve(static_cast<std::size_t>(resamples));
+        for (int i = 0; i < resamples; ++i) {
+            const double numerator = resampled_median(before, scratch_before);
+            const double denominator = resampled_median(after, scratch_after);
+            if (denominator > 0.0) {
+                ratios.push_back(numerator / denominator);
+            }
+        }
+        if (ratios.empty()) {
+            return {};
+        }
+        std::sort(ratios.begin(), ratios.end());
+        const double tail = (1.0 - confidence) / 2.0;
+        auto quantile = [&ratios](double q) {
+            const double position = q * static_cast<double>(ratios.size() - 1);
+            return ratios[static_cast<std::size_t>(std::lround(position))];
+        };
+        return {quantile(tail), quantile(1.0 - tail)};
+    }
+
+    enum class Verdict {
+        kFaster,
+        kSlower,
+        kNoise,
+        kOnlyBefore,
+        kOnlyAfter
+    };
+
+    struct CompareOptions {
+        double alpha = 0.05;         // significance level, also sets the interval's confidence
+        // Smallest |speedup - 1| reported as a change. Samples of one run
+        // share its machine state, so two runs of the same code drifted by up
+        // to 9% here with tiny p-values; the default stays above that.
+        double min_change = 0.10;
+        int resamples = 10000;
+        std::uint64_t seed = 2025;
+    };
+
+    struct KernelChange {
+        std::string name;
+        std::size_t bytes = 0;
+        std::size_t samples_before = 0;
+        std::size_t samples_after = 0;
+        double median_before_ns = 0.0;
+        double median_after_ns = 0.0;
+        double speedup = 1.0;  // median before / median after, above 1 when faster
+        Interval interval;
+        MannWhitney test;
+        Verdict verdict = Verdict::kNoise;
+    };
+
+    // Pair up results by name and size, in the order of the before run
+    // followed by any only in the after run. A change counts only when the
+    // test is significant, the interval excludes 1 and it is at least
+    // min_change; anything else is noise.
+    inline std::vector<KernelChange> compare_runs(const std::vector<SampleSet>& before, const std::vector<SampleSet>& after,
+                                                  const CompareOptions& options = {}) {
+        auto find = [](const std::vector<SampleSet>& results, const SampleSet& wanted) -> const SampleSet* {
+            const auto it = std::find_if(results.begin(), results.end(), [&](const SampleSet& result) {
+                return result.name == wanted.name && result.bytes == wanted.bytes;
+            });
+            return it == results.end() ? nullptr : &*it;
+        };
+
+        std::vector<KernelChange> changes;
+        for (const SampleSet& old_run : before) {
+            KernelChange change;
+            change.name = old_run.name;
+            change.bytes = old_run.bytes;
+            change.samples_before = old_run.samples_ns.size();
+            change.median_before_ns = median(old_run.samples_ns);
+            const SampleSet* new_run = find(after, old_run);
+            if (new_run == nullptr) {
+                change.verdict = Verdict::kOnlyBefore;
+                changes.push_back(std::move(change));
+                continue;
+            }
+            change.samples_after = new_run->samples_ns.size();
+            change.median_after_ns = median(new_run->samples_ns);
+            change.speedup = change.median_after_ns > 0.0 ? change.median_before_ns / change.median_after_ns : 1.0;
+            change.interval = bootstrap_speedup(old_run.samples_ns, new_run->samples_ns, 1.0 - options.alpha,
+                                                options.resamples, options.seed);
+            change.test = mann_whitney(old_run.samples_ns, new_run->samples_ns);
+            const bool significant = change.test.p < options.alpha && !change.interval.contains(1.0) &&
+                                     std::abs(change.speedup - 1.0) >= options.min_change;
+            change.verdict = !significant ? Verdict::kNoise : change.speedup > 1.0 ? Verdict::kFaster : Verdict::kSlower;
+            changes.push_back(std::move(change));
+        }
+        for (const SampleSet& new_run : after) {
+            if (find(before, new_run) == nullptr) {
+                KernelChange change;
+                change.name = new_run.name;
+                change.bytes = new_run.bytes;
+                change.samples_after = new_run.samples_ns.size();
+                change.median_after_ns = median(new_run.samples_ns);
+                change.verdict = Verdict::kOnlyAfter;
+                changes.push_back(std::move(change));
+            }
+        }
+        return changes;
+    }
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace aoc2025::binary {
+    // Appends fixed-width little-endian fields to a string, independent of the
+    // host byte order, for the binary model format (see model_cache.hpp)
+    class Writer {
+        std::string& out_;
+
+    public:
+        explicit Writer(std::string& out) : out_(out) {}
+
+        void put_u8(std::uint8_t value) {
+            out_.push_back(static_cast<char>(value));
+        }
+
+        void put_u16(std::uint16_t value) {
+            out_.push_back(static_cast<char>(value & 0xFF));
+            out_.push_back(static_cast<char>(value >> 8));
+        }
+
+        void put_u32(std::uint32_t value) {
+            for (int shift = 0; shift < 32; shift += 8) {
+                out_.push_back(static_cast<char>((value >> shift) & 0xFF));
+            }
+        }
+
+        void put_u64(std::uint64_t value) {
+            for (int shift = 0; shift < 64; shift += 8) {
+                out_.push_back(static_cast<char>((value >> shift) & 0xFF));
+            }
+        }
+
+        void put_i64(std::int64_t value) {
+            put_u64(static_cast<std::uint64_t>(value));
+        }
+
+        void put_bytes(std::string_view bytes) {
+            out_.append(bytes);
+        }
+    };
+
+    // Reads what Writer wrote; throws std::runtime_error rather than reading
+    // past the end, so truncated files are rejected
+    class Reader {
+        std::string_view bytes_;
+
+    public:
+        explicit Reader(std::string_view bytes) : bytes_(bytes) {}
+
+        std::uint8_t get_u8() {
+            return static_cast<std::uint8_t>(take(1)[0]);
+        }
+
+        std::uint16_t get_u16() {
+            const std::string_view field = take(2);
+            return static_cast<std::uint16_t>(static_cast<unsigned char>(field[0]) |
+                                              static_cast<unsigned char>(field[1]) << 8);
+        }
+
+        std::uint32_t get_u32() {
+            const std::string_view field = take(4);
+            std::uint32_t value = 0;
+            for (int i = 3; i >= 0; --i) {
+                value = (value << 8) | static_cast<unsigned char>(field[static_cast<std::size_t>(i)]);
+            }
+            return value;
+        }
+
+        std::uint64_t get_u64() {
+            const std::string_view field = take(8);
+            std::uint64_t value = 0;
+            for (int i = 7; i >= 0; --i) {
+                value = (value << 8) | static_cast<unsigned char>(field[static_cast<std::size_t>(i)]);
+            }
+            return value;
+        }
+
+        std::int64_t get_i64() {
+            return static_cast<std::int64_t>(get_u64());
+        }
+
+        // A count read from the data, checked against what is left so a
+        // corrupt count cannot trigger a huge allocation
+        std::size_t get_count(std::size_t bytes_per_item) {
+            const std::uint64_t count = get_u64();
+            if (bytes_per_item != 0 && count > bytes_.size() / bytes_per_item) {
+                throw std::runtime_error("Binary model count exceeds its data");
+            }
+            return static_cast<std::size_t>(count);
+        }
+
+        std::string_view get_bytes(std::size_t count) {
+            return take(count);
+        }
+
+        std::size_t remaining() const { return bytes_.size(); }
+        bool at_end() const { return bytes_.empty(); }
+
+    private:
+        std::string_view take(std::size_t count) {
+            if (count > bytes_.size()) {
+                throw std::runtime_error("Truncated binary model");
+            }
+            const std::string_view field = bytes_.substr(0, count);
+            bytes_.remove_prefix(count);
+            return field;
+        }
+    };
+}
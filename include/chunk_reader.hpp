@@ -0,0 +1,66 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+namespace aoc2025 {
+    // Bounded single-producer/single-consumer queue of input chunks. The
+    // producer blocks once depth chunks are waiting, which caps memory use.
+    class ChunkQueue {
+        std::size_t depth_;
+        std::deque<std::string> chunks_;
+        std::mutex mutex_;
+        std::condition_variable changed_;
+        bool closed_ = false;
+        bool cancelled_ = false;
+        std::exception_ptr error_;
+
+    public:
+        explicit ChunkQueue(std::size_t depth) : depth_(depth == 0 ? 1 : depth) {}
+
+        // Returns false once the consumer has cancelled
+        bool push(std::string chunk);
+
+        // End of input, optionally with the error that ended it
+        void close(std::exception_ptr error = nullptr);
+
+        // Consumer gives up; unblocks the producer
+        void cancel();
+
+        // Next chunk, or nullopt at end of input; rethrows a producer error
+        std::optional<std::string> pop();
+    };
+
+    // Reads a file ("-" for stdin) on a background thread in chunk_size pieces,
+    // so reading overlaps with whatever the caller does with each chunk.
+    // gzip or zstd input (see compression.hpp) is decompressed on a second
+    // thread, so reading, decompressing and solving all overlap, and the
+    // chunks hold the decompressed text. Destroying the reader early stops
+    // both threads, even one waiting on a pipe or terminal that never sends
+    // more (on platforms with poll).
+    class ChunkReader {
+        ChunkQueue raw_;
+        ChunkQueue queue_;
+        // Written to by the destructor to wake a reader blocked on its input
+        int wake_fds_[2] = {-1, -1};
+        std::thread reader_;
+        std::thread decoder_;
+
+    public:
+        static constexpr std::size_t kDefaultChunkSize = std::size_t{1} << 20;
+
+        explicit ChunkReader(const std::string& path, std::size_t chunk_size = kDefaultChunkSize, std::size_t depth = 4);
+        ~ChunkReader();
+
+        ChunkReader(const ChunkReader&) = delete;
+        ChunkReader& operator=(const ChunkReader&) = delete;
+
+        std::optional<std::string> next() { return queue_.pop(); }
+    };
+}
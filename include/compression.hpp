@@ -0,0 +1,79 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace aoc2025::compression {
+    // Compressed input formats, told apart by their leading magic bytes.
+    // Support for each is compiled in when CMake finds zlib or libzstd.
+    enum class Format {
+        kNone,
+        kGzip,
+        kZstd
+    };
+
+    // Suffixes tried after dayN/data.txt when only a compressed copy exists
+    inline constexpr std::array<std::string_view, 2> kFileSuffixes{".gz", ".zst"};
+
+    // Format of data starting with head; kNone for plain text or too few bytes
+    constexpr Format detect(std::string_view head) {
+        if (head.size() >= 2 && head[0] == '\x1f' && head[1] == '\x8b') {
+            return Format::kGzip;
+        }
+        if (head.size() >= 4 && head[0] == '\x28' && head[1] == '\xb5' && head[2] == '\x2f' && head[3] == '\xfd') {
+            return Format::kZstd;
+        }
+        return Format::kNone;
+    }
+
+    std::string_view name(Format format);
+
+    // Whether this build can decompress the format; kNone always can
+    bool available(Format format);
+
+    // Incremental decompressor: compressed bytes go in through feed in pieces
+    // of any size, decompressed bytes come out through the sink. Concatenated
+    // gzip members and zstd frames are decoded one after another, as the
+    // command line tools do. Throws std::runtime_error on corrupt data or a
+    // format this build lacks.
+    class Decoder {
+        struct State;
+        std::unique_ptr<State> state_;
+
+    public:
+        using Sink = std::function<void(std::string_view)>;
+
+        explicit Decoder(Format format);
+        ~Decoder();
+
+        Decoder(const Decoder&) = delete;
+        Decoder& operator=(const Decoder&) = delete;
+
+        void feed(std::string_view compressed, const Sink& sink);
+
+        // Throws if the data ended in the middle of a member or frame
+        void finish();
+    };
+
+    // Decompressed length recorded in data, whose first and last bytes are
+    // head and tail: the gzip trailer of the last member (modulo 2^32) or the
+    // zstd frame header. nullopt when the format records none.
+    std::optional<std::uint64_t> stored_size(Format format, std::string_view head, std::string_view tail);
+
+    // Bytes the file at path holds once decompressed, for sizing memory
+    // budgets: the stored length when there is one and it is no smaller than
+    // the file, else the file size. Reads only the ends of the file; 0 when it
+    // cannot be read.
+    std::uint64_t expanded_size(const std::filesystem::path& path);
+
+    // Decompress a whole buffer, sized up front from the stored length when
+    // the format records one
+    std::string decompress(Format format, std::string_view compressed);
+}
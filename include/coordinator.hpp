@@ -0,0 +1,100 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "aoc2025.hpp"
+#include "protocol.hpp"
+#include "runner.hpp"
+#include "thread_pool.hpp"
+
+namespace aoc2025 {
+    // Cut input into at most count pieces of roughly equal size, each ending
+    // just after a delimiter or at the end of the input, so no record is split.
+    // Pieces are never empty; an empty input gives none.
+    std::vector<std::string_view> split_shards(std::string_view input, char delimiter, std::size_t count);
+
+    struct ShardOptions {
+        // Local worker processes to fork, used when no endpoints are given
+        unsigned workers = ThreadPool::default_thread_count();
+
+        // Sockets of running --serve daemons to hand shards to instead of
+        // forking; every request is self-contained, so these may as well be
+        // forwarded to other machines
+        std::vector<std::string> endpoints;
+
+        // Shards per worker: more balance uneven records better and lose less
+        // work to a failed worker
+        std::size_t shards_per_worker = 4;
+
+        // Attempts per shard, across workers, before the whole solve fails
+        int max_attempts = 3;
+
+        // How long a worker may take over one shard before it counts as hung:
+        // it is killed or disconnected and the shard handed out again. Zero
+        // waits forever.
+        std::chrono::milliseconds shard_timeout = std::chrono::seconds(60);
+    };
+
+    struct ShardStats {
+        std::size_t shards = 0;
+        // Shards sent again after their worker died, hung up or timed out
+        std::size_t retries = 0;
+        // Workers forked or reconnected to replace a failed one
+        std::size_t restarts = 0;
+    };
+
+    // Solves shardable days (Day::shard_delimiter) across worker processes
+    // speaking the --serve protocol: the input is cut at record boundaries,
+    // each worker solves one shard at a time and the partial answers are
+    // summed. A worker that dies, disconnects or misses the shard deadline is
+    // replaced and its shard handed out again; an error answer is
+    // deterministic and fails the solve.
+    //
+    // Forked workers inherit the day registry and serve until the coordinator
+    // closes their socket. Fork before starting threads of your own.
+    class Coordinator {
+        struct Worker;
+
+        ShardOptions options_;
+        std::vector<std::unique_ptr<Worker>> workers_;
+        ShardStats stats_;
+
+    public:
+        // Forks or connects to every worker; throws std::runtime_error
+        explicit Coordinator(ShardOptions options);
+        ~Coordinator();
+
+        Coordinator(const Coordinator&) = delete;
+        Coordinator& operator=(const Coordinator&) = delete;
+
+        // Solve one part, sending shards of input through the sockets
+        Answer solve(const Day& day, int part, std::string_view input);
+
+        // Solve one part of a file the workers can open too; shards go out as
+        // byte ranges of path rather than copies of the bytes. A gzip or zstd
+        // file is inflated here and its shards sent as bytes instead.
+        Answer solve_file(const Day& day, int part, const std::filesystem::path& path);
+
+        // Process ids of forked workers still running, -1 for daemon endpoints
+        std::vector<int> worker_pids() const;
+
+        const ShardStats& stats() const { return stats_; }
+
+    private:
+        Answer dispatch(std::vector<protocol::Request> requests);
+        void start(Worker& worker);
+        void stop(Worker& worker);
+    };
+
+    // Solve the single day in options.days from path across workers and print
+    // the answers as a normal run would
+    int run_sharded(const RunOptions& options, const std::string& path, const ShardOptions& shard,
+                    std::ostream& out, std::ostream& err);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+namespace aoc2025::cpu {
+    // x86 feature tiers the hot kernels are compiled for, in increasing order;
+    // other architectures always report kGeneric
+    enum class Level {
+        kGeneric,
+        kSse42,
+        kAvx2,
+        kAvx512
+    };
+
+    // Best tier this CPU supports, read from cpuid once
+    Level detected();
+
+    // The tier kernels dispatch to: detected(), lowered by the AOC2025_CPU
+    // environment variable (generic, sse4.2, avx2 or avx512) when set, e.g.
+    // to benchmark or test the fallbacks on a newer machine
+    Level active();
+
+    std::string_view name(Level level);
+
+    // Inverse of name; nullopt for unknown names
+    std::optional<Level> parse_level(std::string_view text);
+}
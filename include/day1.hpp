@@ -5,8 +5,16 @@
 #include <algorithm>
 #include <vector>
 #include <string>
+#include <string_view>
+#include <stdexcept>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
 
 #include "aoc2025.hpp"
+#include "scan.hpp"
+#include "trace.hpp"
 
 namespace Day1 {
     enum class Direction {
@@ -14,17 +22,42 @@ namespace Day1 {
         kRight = 1
     };
 
+    // Steps are 16 bits: puzzle inputs go into the hundreds and thousands, and
+    // the arithmetic below still promotes them to int. WideRotation takes more.
     struct DialRotation {
         Direction direction;
-        std::uint8_t steps;
+        std::uint16_t steps;
 
-        explicit DialRotation(const std::string& token)
+        constexpr DialRotation(Direction rotation_direction, std::uint16_t rotation_steps)
+            : direction(rotation_direction), steps(rotation_steps) {}
+
+        explicit DialRotation(std::string_view token)
             : direction(token.empty() ? throw std::invalid_argument("Empty token") : (token[0] == 'L' ? Direction::kLeft : Direction::kRight)),
-              steps(static_cast<std::uint8_t>(std::stoi(token.substr(1)))) {
+              steps(parse_steps(token.substr(1))) {
             if (steps == 0) {
                 throw std::invalid_argument("Steps must be greater than zero");
             }
         }
+
+        // As the constructor, but nullopt instead of throwing, so it can parse
+        // in constant expressions
+        static constexpr std::optional<DialRotation> try_parse(std::string_view token) {
+            if (token.empty()) {
+                return std::nullopt;
+            }
+            const auto steps = aoc2025::scan::try_parse_int<std::uint16_t>(aoc2025::scan::trim(token.substr(1)));
+            if (!steps || *steps == 0) {
+                return std::nullopt;
+            }
+            return DialRotation(token[0] == 'L' ? Direction::kLeft : Direction::kRight, *steps);
+        }
+
+    private:
+        // Tolerates surrounding whitespace such as the CR of CRLF input. Steps
+        // beyond 65535 are rejected rather than wrapped.
+        static std::uint16_t parse_steps(std::string_view digits) {
+            return aoc2025::scan::parse_int<std::uint16_t>(aoc2025::scan::trim(digits), "steps");
+        }
     };
 
     enum class CountMode {
@@ -32,15 +65,65 @@ namespace Day1 {
         kCountEnd
     };
 
-    struct Dial {
+    namespace reference {
+        // Clicks of a rotation that land on min, counted one click at a time.
+        // The original definition, kept as the oracle for the arithmetic
+        // version. It reduces positions modulo the range size, so it is only
+        // meaningful for dials starting at 0.
+        inline int count_passes(int position, int min, int max, const DialRotation& rotation) {
+            const int range_size = max - min + 1;
+            int count = 0;
+            for (int i = 1; i <= rotation.steps; ++i) {
+                int pos;
+                if (rotation.direction == Direction::kLeft) {
+                    pos = (position - i) % range_size;
+                    if (pos < 0) {
+                        pos += range_size;
+                    }
+                } else {
+                    pos = (position + i) % range_size;
+                }
+                if (pos == min) {
+                    ++count;
+                }
+            }
+            return count;
+        }
+    }
+
+    namespace detail {
+        // Clicks of a rotation that land on min, in constant time: every full
+        // lap passes it once, plus once more if the remaining arc reaches it
+        constexpr int count_passes(int position, int min, int max, const DialRotation& rotation) {
+            const int range_size = max - min + 1;
+            const int steps = rotation.steps;
+            // Clicks needed to first reach min in the direction of rotation
+            int first;
+            if (rotation.direction == Direction::kLeft) {
+                first = ((position - min) % range_size + range_size) % range_size;
+            } else {
+                first = ((min - position) % range_size + range_size) % range_size;
+            }
+            if (first == 0) {
+                first = range_size;
+            }
+            return steps < first ? 0 : 1 + (steps - first) / range_size;
+        }
+    }
+
+    // What one rotation did: clicks that landed on min, and whether it stopped there
+    struct Turn {
+        int passes = 0;
+        bool ends_at_min = false;
+    };
+
+    // Dial position arithmetic without callbacks, usable in constant expressions
+    struct DialState {
         std::uint8_t min = 0;
         std::uint8_t max = 99;
         std::uint8_t position = 50;
 
-        std::function<void()> on_end_at_min;
-        std::function<void()> on_pass_min;
-
-        void rotate(const DialRotation& rotation) {
+        constexpr Turn turn(const DialRotation& rotation) {
             int new_position = static_cast<int>(position) + static_cast<int>(rotation.direction) * rotation.steps;
             
             // Wrap around: 0-99 range
@@ -53,32 +136,29 @@ namespace Day1 {
             }
             
             // Count passes through min (0) during rotation
+            const int passes = detail::count_passes(position, min, max, rotation);
+            position = static_cast<std::uint8_t>(new_position);
+            return Turn{passes, position == min};
+        }
+    };
+
+    struct Dial : DialState {
+        std::function<void()> on_end_at_min;
+        std::function<void()> on_pass_min;
+
+        void rotate(const DialRotation& rotation) {
+            const Turn result = turn(rotation);
             if (on_pass_min) {
-                const int start_value = static_cast<int>(position);
-                for (int i = 1; i <= rotation.steps; ++i) {
-                    int pos;
-                    if (rotation.direction == Direction::kLeft) {
-                        pos = (start_value - i) % range_size;
-                        if (pos < 0) {
-                            pos += range_size;
-                        }
-                    } else {
-                        pos = (start_value + i) % range_size;
-                    }
-                    if (pos == min) {
-                        on_pass_min();
-                    }
+                for (int i = 0; i < result.passes; ++i) {
+                    on_pass_min();
                 }
             }
-            
-            position = static_cast<std::uint8_t>(new_position);
-            
-            if (on_end_at_min && position == min) {
+            if (on_end_at_min && result.ends_at_min) {
                 on_end_at_min();
             }
         }
 
-        void rotate(const std::vector<DialRotation>& rotations) {
+        void rotate(std::span<const DialRotation> rotations) {
             for (const auto& rotation : rotations) {
                 rotate(rotation);
             }
@@ -86,22 +166,65 @@ namespace Day1 {
     };
 
     class DialRotations {
-        std::vector<DialRotation> rotations;
+        std::pmr::vector<DialRotation> rotations;
 
     public:
-        explicit DialRotations(const std::string& input_string) {
-            std::istringstream input_stream(input_string);
-            std::string line;
-            while (std::getline(input_stream, line)) {
+        explicit DialRotations(std::string_view input_string,
+                               std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : rotations(resource) {
+            AOC2025_TRACE_ZONE("day1/parse");
+            rotations.reserve(aoc2025::scan::count_byte(input_string, '\n') + 1);
+            for (const std::string_view line : aoc2025::scan::lines(input_string)) {
                 if (!line.empty()) {
                     rotations.emplace_back(line);
                 }
             }
         }
 
+        // Rebuild from the binary form written by save
+        DialRotations(aoc2025::binary::Reader& reader,
+                      std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : rotations(resource) {
+            AOC2025_TRACE_ZONE("day1/load");
+            const std::size_t count = reader.get_count(2);
+            rotations.reserve(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                rotations.emplace_back(Direction::kRight, reader.get_u16());
+            }
+            const std::string_view left = reader.get_bytes((count + 7) / 8);
+            for (std::size_t i = 0; i < count; ++i) {
+                if (rotations[i].steps == 0) {
+                    throw std::runtime_error("Binary model has a rotation of zero steps");
+                }
+                if ((static_cast<unsigned char>(left[i / 8]) >> (i % 8)) & 1) {
+                    rotations[i].direction = Direction::kLeft;
+                }
+            }
+        }
+
+        // Binary form: the count, every step count as 16 bits, then one
+        // direction bit per rotation (set for left), eight to a byte
+        void save(std::string& out) const {
+            aoc2025::binary::Writer writer(out);
+            writer.put_u64(rotations.size());
+            for (const DialRotation& rotation : rotations) {
+                writer.put_u16(rotation.steps);
+            }
+            std::uint8_t bits = 0;
+            for (std::size_t i = 0; i < rotations.size(); ++i) {
+                if (rotations[i].direction == Direction::kLeft) {
+                    bits |= static_cast<std::uint8_t>(1u << (i % 8));
+                }
+                if (i % 8 == 7 || i + 1 == rotations.size()) {
+                    writer.put_u8(bits);
+                    bits = 0;
+                }
+            }
+        }
+
         auto begin() const { return rotations.begin(); }
         auto end() const { return rotations.end(); }
-        const std::vector<DialRotation>& get() const { return rotations; }
+        const std::pmr::vector<DialRotation>& get() const { return rotations; }
     };
 
     class DialCounter {
@@ -141,8 +264,8 @@ namespace Day1 {
     };
 
     namespace detail {
-        inline std::int64_t solve_common(const std::string& input, CountMode mode) {
-            DialRotations rotations(input);
+        inline std::int64_t solve_common(const DialRotations& rotations, CountMode mode) {
+            AOC2025_TRACE_ZONE("day1/solve");
             Dial dial;
             DialCounter counter(dial, mode);
             
@@ -152,12 +275,380 @@ namespace Day1 {
         }
     }
 
-    inline std::ostream& solve_part1(std::ostream& os, const std::string& input) {        
-        return os << detail::solve_common(input, CountMode::kCountEnd);
+    // A rotation of any number of clicks, for dials beyond DialRotation's 16 bits
+    struct WideRotation {
+        Direction direction = Direction::kRight;
+        std::uint64_t steps = 0;
+
+        constexpr WideRotation(Direction rotation_direction, std::uint64_t rotation_steps)
+            : direction(rotation_direction), steps(rotation_steps) {}
+
+        constexpr WideRotation(const DialRotation& rotation)
+            : direction(rotation.direction), steps(rotation.steps) {}
+
+        // "L68" or "R123456789012", throws like DialRotation
+        explicit WideRotation(std::string_view token)
+            : direction(token.empty() ? throw std::invalid_argument("Empty token") : (token[0] == 'L' ? Direction::kLeft : Direction::kRight)),
+              steps(aoc2025::scan::parse_int<std::uint64_t>(aoc2025::scan::trim(token.substr(1)), "steps")) {
+            if (steps == 0) {
+                throw std::invalid_argument("Steps must be greater than zero");
+            }
+        }
+    };
+
+    // Dial over any 64-bit range min..max. Positions are handled as offsets
+    // from min in unsigned arithmetic, so no step count or range overflows.
+    class WideDial {
+        std::int64_t min_;
+        std::uint64_t size_;
+        std::uint64_t offset_;
+
+    public:
+        // Throws std::invalid_argument for min > max, a range of all 2^64
+        // values, or a position outside it
+        constexpr WideDial(std::int64_t min = 0, std::int64_t max = 99, std::int64_t position = 50)
+            : min_(min),
+              size_(static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min) + 1),
+              offset_(static_cast<std::uint64_t>(position) - static_cast<std::uint64_t>(min)) {
+            if (min > max || size_ == 0) {
+                throw std::invalid_argument("Dial range must hold between 1 and 2^64 - 1 positions");
+            }
+            if (position < min || position > max) {
+                throw std::invalid_argument("Dial position outside its range");
+            }
+        }
+
+        constexpr std::int64_t min() const { return min_; }
+        constexpr std::int64_t max() const { return static_cast<std::int64_t>(static_cast<std::uint64_t>(min_) + size_ - 1); }
+        constexpr std::int64_t position() const { return static_cast<std::int64_t>(static_cast<std::uint64_t>(min_) + offset_); }
+        constexpr std::uint64_t size() const { return size_; }
+        constexpr std::uint64_t offset() const { return offset_; }
+
+        // Offset of position from min, nullopt outside the range
+        constexpr std::optional<std::uint64_t> offset_of(std::int64_t position) const {
+            const std::uint64_t offset = static_cast<std::uint64_t>(position) - static_cast<std::uint64_t>(min_);
+            return position < min_ || offset >= size_ ? std::nullopt : std::optional<std::uint64_t>(offset);
+        }
+
+        // Clicks of a rotation from here that land on target: every full lap
+        // passes it once, plus once more if the remaining arc reaches it. The
+        // wide form of detail::count_passes.
+        constexpr std::uint64_t visits(const WideRotation& rotation, std::int64_t position) const {
+            const std::optional<std::uint64_t> target = offset_of(position);
+            if (!target) {
+                return 0;
+            }
+            std::uint64_t first = rotation.direction == Direction::kRight ? distance(offset_, *target) : distance(*target, offset_);
+            if (first == 0) {
+                first = size_;
+            }
+            return rotation.steps < first ? 0 : 1 + (rotation.steps - first) / size_;
+        }
+
+        constexpr void rotate(const WideRotation& rotation) {
+            const std::uint64_t arc = rotation.steps % size_;
+            offset_ = rotation.direction == Direction::kRight ? advance(offset_, arc) : advance(offset_, size_ - arc == size_ ? 0 : size_ - arc);
+        }
+
+    private:
+        // Clicks to the right from from to to
+        constexpr std::uint64_t distance(std::uint64_t from, std::uint64_t to) const {
+            return to >= from ? to - from : size_ - (from - to);
+        }
+
+        // offset + clicks modulo the size, for clicks below the size
+        constexpr std::uint64_t advance(std::uint64_t offset, std::uint64_t clicks) const {
+            return clicks >= size_ - offset ? clicks - (size_ - offset) : offset + clicks;
+        }
+    };
+
+    // Counts, for every position of a set of targets, the clicks that land
+    // on it and the rotations that stop on it. A rotation of s clicks makes
+    // s / size full laps, which visit every target once each and are kept
+    // as a single lap count, and a partial arc of s % size clicks, which
+    // covers a contiguous run of the sorted targets and is added to a
+    // difference array at its two ends. So each rotation costs two binary
+    // searches however long it is and however many targets there are (none
+    // for a histogram of every position), and the per-target counts are
+    // summed up only when asked for.
+    class VisitCounter {
+        WideDial dial_;
+        std::vector<std::uint64_t> targets_;  // sorted offsets from min
+        std::vector<std::int64_t> arcs_;      // difference array over targets_
+        std::vector<std::uint64_t> ends_;
+        std::uint64_t laps_ = 0;
+        std::uint64_t total_passes_ = 0;
+        std::uint64_t total_ends_ = 0;
+        // Every position is a target, so a target's index is its offset
+        bool dense_ = false;
+
+    public:
+        // Histograms over more positions than this must use explicit targets
+        static constexpr std::uint64_t kMaxHistogramSize = std::uint64_t{1} << 26;
+
+        // Throws std::invalid_argument for a target outside the dial's range;
+        // repeated targets are counted once
+        VisitCounter(const WideDial& dial, std::span<const std::int64_t> targets) : dial_(dial) {
+            targets_.reserve(targets.size());
+            for (const std::int64_t target : targets) {
+                const std::optional<std::uint64_t> offset = dial.offset_of(target);
+                if (!offset) {
+                    throw std::invalid_argument("Target " + std::to_string(target) + " outside the dial");
+                }
+                targets_.push_back(*offset);
+            }
+            std::sort(targets_.begin(), targets_.end());
+            targets_.erase(std::unique(targets_.begin(), targets_.end()), targets_.end());
+            arcs_.assign(targets_.size() + 1, 0);
+            ends_.assign(targets_.size(), 0);
+            dense_ = targets_.size() == dial.size();
+        }
+
+        // Every position of the dial as a target: the full visit histogram
+        static VisitCounter histogram(const WideDial& dial) {
+            if (dial.size() > kMaxHistogramSize) {
+                throw std::invalid_argument("Dial too large for a histogram of every position");
+            }
+            std::vector<std::int64_t> positions(dial.size());
+            for (std::uint64_t offset = 0; offset < dial.size(); ++offset) {
+                positions[offset] = static_cast<std::int64_t>(static_cast<std::uint64_t>(dial.min()) + offset);
+            }
+            return VisitCounter(dial, positions);
+        }
+
+        void rotate(const WideRotation& rotation) {
+            const std::uint64_t size = dial_.size();
+            const std::uint64_t laps = rotation.steps / size;
+            const std::uint64_t arc = rotation.steps % size;
+            laps_ += laps;
+            total_passes_ += laps * targets_.size();
+            if (arc != 0) {
+                // Right covers offset + 1 .. offset + arc, left offset - arc .. offset - 1
+                const std::uint64_t offset = dial_.offset();
+                const std::uint64_t start = rotation.direction == Direction::kRight
+                    ? (offset + 1 == size ? 0 : offset + 1)
+                    : (offset >= arc ? offset - arc : size - (arc - offset));
+                if (arc <= size - start) {
+                    add_arc(start, start + arc);
+                } else {
+                    add_arc(start, size);
+                    add_arc(0, arc - (size - start));
+                }
+            }
+            dial_.rotate(rotation);
+            const std::size_t end = index_of(dial_.offset());
+            if (end < targets_.size() && targets_[end] == dial_.offset()) {
+                ++ends_[end];
+                ++total_ends_;
+            }
+        }
+
+        void rotate(std::span<const DialRotation> rotations) {
+            for (const DialRotation& rotation : rotations) {
+                rotate(WideRotation(rotation));
+            }
+        }
+
+        const WideDial& dial() const { return dial_; }
+
+        // The distinct targets in increasing order, which the counts follow
+        std::vector<std::int64_t> targets() const {
+            std::vector<std::int64_t> positions;
+            positions.reserve(targets_.size());
+            for (const std::uint64_t offset : targets_) {
+                positions.push_back(static_cast<std::int64_t>(static_cast<std::uint64_t>(dial_.min()) + offset));
+            }
+            return positions;
+        }
+
+        // Clicks that landed on each target
+        std::vector<std::uint64_t> passes() const {
+            std::vector<std::uint64_t> counts(targets_.size());
+            std::int64_t running = 0;
+            for (std::size_t i = 0; i < targets_.size(); ++i) {
+                running += arcs_[i];
+                counts[i] = laps_ + static_cast<std::uint64_t>(running);
+            }
+            return counts;
+        }
+
+        // Rotations that stopped on each target
+        const std::vector<std::uint64_t>& ends() const { return ends_; }
+
+        // Sums over all targets, kept as rotations are applied
+        std::uint64_t total_passes() const { return total_passes_; }
+        std::uint64_t total_ends() const { return total_ends_; }
+
+    private:
+        // One more visit for every target with an offset in [from, to)
+        void add_arc(std::uint64_t from, std::uint64_t to) {
+            const std::size_t first = index_of(from);
+            const std::size_t last = index_of(to);
+            ++arcs_[first];
+            --arcs_[last];
+            total_passes_ += last - first;
+        }
+
+        // Index of the first target at or after offset
+        std::size_t index_of(std::uint64_t offset) const {
+            if (dense_) {
+                return static_cast<std::size_t>(offset);
+            }
+            return static_cast<std::size_t>(std::lower_bound(targets_.begin(), targets_.end(), offset) - targets_.begin());
+        }
+    };
+
+    // Streaming solver: applies each rotation as soon as its line is complete
+    class DialStream : public aoc2025::StreamSolver {
+        Dial dial_;
+        DialCounter counter_;
+        aoc2025::RecordSplitter lines_{'\n'};
+
+    public:
+        explicit DialStream(CountMode mode) : counter_(dial_, mode) {}
+
+        void feed(std::string_view chunk) override {
+            lines_.feed(chunk, [this](std::string_view line) { rotate(line); });
+        }
+
+        aoc2025::Answer finish() override {
+            lines_.finish([this](std::string_view line) { rotate(line); });
+            return counter_.get_count();
+        }
+
+    private:
+        void rotate(std::string_view line) {
+            if (!line.empty()) {
+                dial_.rotate(DialRotation(line));
+            }
+        }
+    };
+
+    inline std::unique_ptr<aoc2025::StreamSolver> make_stream(int part) {
+        return std::make_unique<DialStream>(part == 1 ? CountMode::kCountEnd : CountMode::kCountPass);
+    }
+
+    // Incremental solver: every line keeps the dial position it leaves behind
+    // and what it counted, so an edit restarts the dial from the line before
+    // the first changed one. A rotation maps start positions one to one onto
+    // end positions, so once a later line ends where it did before it also
+    // started there, and nothing after it can have changed.
+    class DialIncremental : public aoc2025::IncrementalSolver {
+        struct Line {
+            std::uint16_t steps = 0;  // zero for an empty line
+            Direction direction = Direction::kRight;
+            std::uint8_t position = 0;
+            std::uint16_t passes = 0;  // at most steps
+            bool ends_at_min = false;
+        };
+
+        aoc2025::RecordIndex<Line> lines_{'\n'};
+        std::int64_t passes_ = 0;
+        std::int64_t ends_ = 0;
+
+    public:
+        aoc2025::Answer answer(int part) const override {
+            return part == 1 ? ends_ : passes_;
+        }
+
+    protected:
+        std::size_t on_edit(std::string_view text, std::size_t offset, std::size_t erased,
+                            std::size_t inserted) override {
+            const auto splice = lines_.apply(text, offset, erased, inserted,
+                [](std::string_view record) {
+                    Line line;
+                    if (!record.empty()) {
+                        const DialRotation rotation(record);
+                        line.steps = rotation.steps;
+                        line.direction = rotation.direction;
+                    }
+                    return line;
+                },
+                [this](const Line& line) {
+                    passes_ -= line.passes;
+                    ends_ -= line.ends_at_min ? 1 : 0;
+                });
+
+            DialState dial;
+            if (splice.first > 0) {
+                dial.position = lines_[splice.first - 1].position;
+            }
+            std::size_t index = splice.first;
+            for (; index < lines_.size(); ++index) {
+                Line& line = lines_[index];
+                Turn turn;
+                if (line.steps != 0) {
+                    turn = dial.turn(DialRotation(line.direction, line.steps));
+                }
+                if (index >= splice.first + splice.added && line.position == dial.position) {
+                    break;
+                }
+                passes_ += turn.passes - line.passes;
+                ends_ += (turn.ends_at_min ? 1 : 0) - (line.ends_at_min ? 1 : 0);
+                line.position = dial.position;
+                line.passes = static_cast<std::uint16_t>(turn.passes);
+                line.ends_at_min = turn.ends_at_min;
+            }
+            return index - splice.first;
+        }
+    };
+
+    inline std::unique_ptr<aoc2025::IncrementalSolver> make_incremental() {
+        return std::make_unique<DialIncremental>();
+    }
+
+    // Solvers without allocation, callbacks or exceptions, so answers for
+    // inputs known at compile time are computed by the compiler. nullopt on
+    // input the runtime parser would reject.
+    namespace constant {
+        constexpr std::optional<std::int64_t> count_at_min(std::string_view input, CountMode mode) {
+            DialState dial;
+            std::int64_t count = 0;
+            for (const std::string_view line : aoc2025::scan::lines(input)) {
+                if (line.empty()) {
+                    continue;
+                }
+                const std::optional<DialRotation> rotation = DialRotation::try_parse(line);
+                if (!rotation) {
+                    return std::nullopt;
+                }
+                const Turn result = dial.turn(*rotation);
+                count += mode == CountMode::kCountPass ? result.passes : (result.ends_at_min ? 1 : 0);
+            }
+            return count;
+        }
+
+        constexpr std::optional<std::int64_t> answer_part1(std::string_view input) {
+            return count_at_min(input, CountMode::kCountEnd);
+        }
+
+        constexpr std::optional<std::int64_t> answer_part2(std::string_view input) {
+            return count_at_min(input, CountMode::kCountPass);
+        }
+    }
+
+    inline aoc2025::Answer answer_part1(const DialRotations& rotations) {
+        return detail::solve_common(rotations, CountMode::kCountEnd);
+    }
+
+    inline aoc2025::Answer answer_part2(const DialRotations& rotations) {
+        return detail::solve_common(rotations, CountMode::kCountPass);
+    }
+
+    inline aoc2025::Answer answer_part1(std::string_view input) {
+        return answer_part1(DialRotations(input));
+    }
+
+    inline aoc2025::Answer answer_part2(std::string_view input) {
+        return answer_part2(DialRotations(input));
+    }
+
+    inline std::ostream& solve_part1(std::ostream& os, std::string_view input) {        
+        return os << answer_part1(input);
     }
     
-    inline std::ostream& solve_part2(std::ostream& os, const std::string& input) {
-        return os << detail::solve_common(input, CountMode::kCountPass);
+    inline std::ostream& solve_part2(std::ostream& os, std::string_view input) {
+        return os << answer_part2(input);
     }
 
     extern const aoc2025::Day Day1;
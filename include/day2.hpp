@@ -7,10 +7,15 @@
 #include <stdexcept>
 #include <cstdint>
 #include <optional>
-#include <functional>
 #include <algorithm>
+#include <array>
+#include <limits>
+#include <memory>
+#include <memory_resource>
 
 #include "aoc2025.hpp"
+#include "scan.hpp"
+#include "trace.hpp"
 
 namespace Day2 {
 
@@ -18,128 +23,463 @@ namespace Day2 {
         std::int64_t start;
         std::int64_t end;
 
+        constexpr Range(std::int64_t first, std::int64_t last) : start(first), end(last) {}
+
         explicit Range(const std::string& range_string) 
             : Range(std::string_view(range_string)) {}
         
         explicit Range(const char* range_string) 
             : Range(std::string_view(range_string)) {}
 
-    private:
+        // Surrounding whitespace is ignored, e.g. the newline after the last range
         explicit Range(std::string_view range_string) {
+            range_string = aoc2025::scan::trim(range_string);
             const size_t dash_pos = range_string.find('-');
             if (dash_pos == std::string_view::npos || dash_pos == 0 || dash_pos == range_string.length() - 1) {
                 throw std::invalid_argument("Invalid range format: " + std::string(range_string));
             }
             
-            const std::string_view start_str = range_string.substr(0, dash_pos);
-            const std::string_view end_str = range_string.substr(dash_pos + 1);
-            
-            try {
-                start = std::stoll(std::string(start_str));
-                end = std::stoll(std::string(end_str));
-            } catch (const std::exception&) {
+            const auto start_value = aoc2025::scan::try_parse_int<std::int64_t>(range_string.substr(0, dash_pos));
+            const auto end_value = aoc2025::scan::try_parse_int<std::int64_t>(range_string.substr(dash_pos + 1));
+            if (!start_value || !end_value) {
                 throw std::invalid_argument("Invalid range numbers: " + std::string(range_string));
             }
+            start = *start_value;
+            end = *end_value;
             
             if (start > end) {
                 throw std::invalid_argument("Range start greater than end: " + std::string(range_string));
             }
         }
+
+        // As the constructor, but nullopt instead of throwing, so it can parse
+        // in constant expressions
+        static constexpr std::optional<Range> try_parse(std::string_view range_string) {
+            range_string = aoc2025::scan::trim(range_string);
+            const size_t dash_pos = range_string.find('-');
+            if (dash_pos == std::string_view::npos || dash_pos == 0 || dash_pos == range_string.length() - 1) {
+                return std::nullopt;
+            }
+            const auto start_value = aoc2025::scan::try_parse_int<std::int64_t>(range_string.substr(0, dash_pos));
+            const auto end_value = aoc2025::scan::try_parse_int<std::int64_t>(range_string.substr(dash_pos + 1));
+            if (!start_value || !end_value || *start_value > *end_value) {
+                return std::nullopt;
+            }
+            return Range(*start_value, *end_value);
+        }
     };
 
+    namespace reference {
+        // The original string-based checks, kept as oracles for the arithmetic
+        // versions below
+
+        // Take number and return number if it consists of two groups of equal digits,
+        // otherwise return empty optional
+        inline std::optional<std::int64_t> part1_id_of_concern(std::int64_t number) {
+            const std::string digits = std::to_string(number);
+            if (digits.length() % 2 != 0) {
+                return std::nullopt;
+            }
+            
+            const size_t mid = digits.length() / 2;
+            if (digits.substr(0, mid) == digits.substr(mid)) {
+                return number;
+            }
+            return std::nullopt;
+        }
+
+        // Return number if it contains only repeating parts, otherwise return empty optional
+        // Checks if the number is composed of a repeating pattern
+        inline std::optional<std::int64_t> part2_id_of_concern(std::int64_t number) {
+            const std::string digits = std::to_string(number);
+            const size_t length = digits.length();
+            
+            // Try all possible segment lengths that divide evenly into the total length
+            for (size_t segment_len = 1; segment_len <= length / 2; ++segment_len) {
+                if (length % segment_len != 0) {
+                    continue;
+                }
+                const std::string_view segment = std::string_view(digits).substr(0, segment_len);
+                const size_t repetitions = length / segment_len;
+                
+                bool matches = true;
+                for (size_t rep = 1; rep < repetitions && matches; ++rep) {
+                    const size_t offset = rep * segment_len;
+                    const std::string_view current_segment = std::string_view(digits).substr(offset, segment_len);
+                    if (segment != current_segment) {
+                        matches = false;
+                    }
+                }
+                
+                if (matches) {
+                    return number;
+                }
+            }
+            return std::nullopt;
+        }
+
+        // Sum of the IDs of concern in range, checking every number
+        template <typename IdChecker>
+        std::int64_t sum_range(const Range& range, IdChecker id_checker) {
+            std::int64_t result = 0;
+            for (std::int64_t i = range.start; i <= range.end; ++i) {
+                if (auto id = id_checker(i)) {
+                    result += *id;
+                }
+            }
+            return result;
+        }
+    }
+
+    namespace detail {
+        inline constexpr int kMaxDigits = 19;
+
+        constexpr int digit_count(std::uint64_t number) {
+            int digits = 1;
+            for (std::uint64_t limit = 10; digits < 20 && number >= limit; limit *= 10) {
+                ++digits;
+            }
+            return digits;
+        }
+
+        constexpr std::uint64_t power_of_10(int exponent) {
+            std::uint64_t result = 1;
+            for (int i = 0; i < exponent; ++i) {
+                result *= 10;
+            }
+            return result;
+        }
+
+        // 1 followed by period-digit groups, e.g. (6, 2) -> 10101; a digits-long
+        // number repeats with that period exactly when it is its leading block
+        // times this
+        constexpr std::uint64_t repunit(int digits, int period) {
+            std::uint64_t result = 0;
+            for (int covered = 0; covered < digits; covered += period) {
+                result = result * power_of_10(period) + 1;
+            }
+            return result;
+        }
+
+        constexpr bool has_period(std::uint64_t number, int digits, int period) {
+            const std::uint64_t block = number / power_of_10(digits - period);
+            return block * repunit(digits, period) == number;
+        }
+    }
+
     // Take number and return number if it consists of two groups of equal digits,
     // otherwise return empty optional
-    inline std::optional<std::int64_t> Part1IdOfConcern(std::int64_t number) {
-        const std::string digits = std::to_string(number);
-        if (digits.length() % 2 != 0) {
+    constexpr std::optional<std::int64_t> Part1IdOfConcern(std::int64_t number) {
+        if (number < 0) {
             return std::nullopt;
         }
-        
-        const size_t mid = digits.length() / 2;
-        if (digits.substr(0, mid) == digits.substr(mid)) {
-            return number;
+        const int digits = detail::digit_count(static_cast<std::uint64_t>(number));
+        if (digits % 2 != 0 || !detail::has_period(static_cast<std::uint64_t>(number), digits, digits / 2)) {
+            return std::nullopt;
         }
-        return std::nullopt;
+        return number;
     }
 
     // Return number if it contains only repeating parts, otherwise return empty optional
-    // Checks if the number is composed of a repeating pattern
-    inline std::optional<std::int64_t> Part2IdOfConcern(std::int64_t number) {
-        const std::string digits = std::to_string(number);
-        const size_t length = digits.length();
-        
-        // Try all possible segment lengths that divide evenly into the total length
-        for (size_t segment_len = 1; segment_len <= length / 2; ++segment_len) {
-            if (length % segment_len != 0) {
-                continue;
+    constexpr std::optional<std::int64_t> Part2IdOfConcern(std::int64_t number) {
+        if (number < 0) {
+            return std::nullopt;
+        }
+        const int digits = detail::digit_count(static_cast<std::uint64_t>(number));
+        for (int period = 1; period <= digits / 2; ++period) {
+            if (digits % period == 0 && detail::has_period(static_cast<std::uint64_t>(number), digits, period)) {
+                return number;
             }
-            const std::string_view segment = std::string_view(digits).substr(0, segment_len);
-            const size_t repetitions = length / segment_len;
-            
-            bool matches = true;
-            for (size_t rep = 1; rep < repetitions && matches; ++rep) {
-                const size_t offset = rep * segment_len;
-                const std::string_view current_segment = std::string_view(digits).substr(offset, segment_len);
-                if (segment != current_segment) {
-                    matches = false;
+        }
+        return std::nullopt;
+    }
+
+    namespace detail {
+#ifdef AOC2025_HAVE_INT128
+        using Wide = aoc2025::Int128;
+
+        constexpr Wide wide_power_of_10(int exponent) {
+            Wide result = 1;
+            for (int i = 0; i < exponent; ++i) {
+                result *= 10;
+            }
+            return result;
+        }
+
+        // Sum of the digits-long numbers in [first, last] that repeat with period
+        // period: they are block * repunit for every period-digit block, so the
+        // sum is an arithmetic series over the blocks in range
+        constexpr Wide sum_periodic(const Range& range, int digits, int period) {
+            Wide multiplier = 0;
+            for (int covered = 0; covered < digits; covered += period) {
+                multiplier = multiplier * wide_power_of_10(period) + 1;
+            }
+            const Wide first = range.start;
+            const Wide last = range.end;
+            Wide low = std::max(wide_power_of_10(period - 1), (first + multiplier - 1) / multiplier);
+            Wide high = std::min(wide_power_of_10(period) - 1, last / multiplier);
+            if (low > high) {
+                return 0;
+            }
+            return (low + high) * (high - low + 1) / 2 * multiplier;
+        }
+
+        inline std::int64_t to_int64(Wide sum) {
+            if (sum > std::numeric_limits<std::int64_t>::max()) {
+                throw std::overflow_error("Range sum overflows 64 bits");
+            }
+            return static_cast<std::int64_t>(sum);
+        }
+
+        // Sum of Part1IdOfConcern over range without visiting every number
+        constexpr Wide wide_sum_part1(const Range& range) {
+            if (range.end < 0) {
+                return 0;
+            }
+            const int low_digits = digit_count(static_cast<std::uint64_t>(std::max<std::int64_t>(range.start, 0)));
+            const int high_digits = digit_count(static_cast<std::uint64_t>(range.end));
+            Wide sum = 0;
+            for (int digits = low_digits; digits <= high_digits; ++digits) {
+                if (digits % 2 == 0) {
+                    sum += sum_periodic(range, digits, digits / 2);
                 }
             }
-            
-            if (matches) {
-                return number;
+            return sum;
+        }
+
+        // Sum of Part2IdOfConcern over range without visiting every number. A
+        // number repeats with some proper period exactly when it repeats with
+        // digits / p for a prime p dividing digits; overlaps between those sets
+        // are removed by inclusion-exclusion, since repeating with periods a
+        // and b means repeating with gcd(a, b).
+        constexpr Wide wide_sum_part2(const Range& range) {
+            if (range.end < 0) {
+                return 0;
+            }
+            const int low_digits = digit_count(static_cast<std::uint64_t>(std::max<std::int64_t>(range.start, 0)));
+            const int high_digits = digit_count(static_cast<std::uint64_t>(range.end));
+            Wide sum = 0;
+            for (int digits = std::max(low_digits, 2); digits <= high_digits; ++digits) {
+                // At most two distinct primes divide a count of up to 20 digits
+                std::array<int, 4> primes{};
+                std::size_t prime_count = 0;
+                for (int p = 2, rest = digits; p <= rest; ++p) {
+                    if (rest % p == 0) {
+                        primes[prime_count++] = p;
+                        while (rest % p == 0) {
+                            rest /= p;
+                        }
+                    }
+                }
+                for (unsigned subset = 1; subset < (1u << prime_count); ++subset) {
+                    int period = digits;
+                    int size = 0;
+                    for (std::size_t i = 0; i < prime_count; ++i) {
+                        if (subset & (1u << i)) {
+                            period /= primes[i];
+                            ++size;
+                        }
+                    }
+                    const Wide part = sum_periodic(range, digits, period);
+                    sum += size % 2 == 1 ? part : -part;
+                }
             }
+            return sum;
+        }
+#endif
+
+        // The range sums as 64-bit values; throw std::overflow_error when they do not fit
+        inline std::int64_t sum_part1(const Range& range) {
+#ifdef AOC2025_HAVE_INT128
+            return to_int64(wide_sum_part1(range));
+#else
+            return range.end < 0 ? 0 : reference::sum_range(range, Part1IdOfConcern);
+#endif
+        }
+
+        inline std::int64_t sum_part2(const Range& range) {
+#ifdef AOC2025_HAVE_INT128
+            return to_int64(wide_sum_part2(range));
+#else
+            return range.end < 0 ? 0 : reference::sum_range(range, Part2IdOfConcern);
+#endif
         }
-        return std::nullopt;
     }
 
     class Ranges {
-        std::vector<Range> ranges_;
+        std::pmr::vector<Range> ranges_;
 
     public:
-        explicit Ranges(const std::string& input_string) {
-            ranges_.reserve(std::count(input_string.begin(), input_string.end(), ',') + 1);
-            
-            std::istringstream input_stream(input_string);
-            std::string token;
+        explicit Ranges(std::string_view input_string,
+                        std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : ranges_(resource) {
+            AOC2025_TRACE_ZONE("day2/parse");
+            ranges_.reserve(aoc2025::scan::count_byte(input_string, ',') + 1);
             
-            while (std::getline(input_stream, token, ',')) {
-                if (!token.empty()) {
+            for (const std::string_view token : aoc2025::scan::split(input_string, ',')) {
+                if (!aoc2025::scan::trim(token).empty()) {
                     ranges_.emplace_back(token);
                 }
             }
         }
 
+        // Rebuild from the binary form written by save
+        Ranges(aoc2025::binary::Reader& reader,
+               std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : ranges_(resource) {
+            AOC2025_TRACE_ZONE("day2/load");
+            const std::size_t count = reader.get_count(16);
+            ranges_.reserve(count);
+            for (std::size_t i = 0; i < count; ++i) {
+                const std::int64_t start = reader.get_i64();
+                const std::int64_t end = reader.get_i64();
+                if (start > end) {
+                    throw std::runtime_error("Binary model has a range with start greater than end");
+                }
+                ranges_.emplace_back(start, end);
+            }
+        }
+
+        // Binary form: the count, then start and end of each range as 64-bit integers
+        void save(std::string& out) const {
+            aoc2025::binary::Writer writer(out);
+            writer.put_u64(ranges_.size());
+            for (const Range& range : ranges_) {
+                writer.put_i64(range.start);
+                writer.put_i64(range.end);
+            }
+        }
+
         auto begin() const { return ranges_.begin(); }
         auto end() const { return ranges_.end(); }
-        const std::vector<Range>& get() const { return ranges_; }
+        const std::pmr::vector<Range>& get() const { return ranges_; }
     };
 
     namespace detail {
-        inline std::int64_t solve_common(
-            const std::string& input,
-            std::function<std::optional<std::int64_t>(std::int64_t)> id_checker) {
-            Ranges ranges(input);
+        using RangeSum = std::int64_t(*)(const Range&);
+
+        // total + sum under the same rule as each range sum: std::overflow_error
+        // rather than a wrapped total. Range sums are never negative.
+        inline std::int64_t add_sum(std::int64_t total, std::int64_t sum) {
+            if (sum > std::numeric_limits<std::int64_t>::max() - total) {
+                throw std::overflow_error("Sum of ranges overflows 64 bits");
+            }
+            return total + sum;
+        }
+
+        inline std::int64_t solve_common(const Ranges& ranges, RangeSum sum_range) {
+            AOC2025_TRACE_ZONE("day2/solve");
             std::int64_t result = 0;
             
             for (const auto& range : ranges.get()) {
-                for (std::int64_t i = range.start; i <= range.end; ++i) {
-                    if (auto id = id_checker(i)) {
-                        result += *id;
-                    }
-                }
+                result = add_sum(result, sum_range(range));
             }
             
             return result;
         }
     }
 
-    inline std::ostream& solve_part1(std::ostream& os, const std::string& input) {
-        os << detail::solve_common(input, Part1IdOfConcern);
+    // Streaming solver: sums each range as soon as its comma-separated token is complete
+    class RangeStream : public aoc2025::StreamSolver {
+        detail::RangeSum sum_range_;
+        aoc2025::RecordSplitter tokens_{','};
+        std::int64_t result_ = 0;
+
+    public:
+        explicit RangeStream(detail::RangeSum sum_range) : sum_range_(sum_range) {}
+
+        void feed(std::string_view chunk) override {
+            tokens_.feed(chunk, [this](std::string_view token) { add(token); });
+        }
+
+        aoc2025::Answer finish() override {
+            tokens_.finish([this](std::string_view token) { add(token); });
+            return result_;
+        }
+
+    private:
+        void add(std::string_view token) {
+            if (!aoc2025::scan::trim(token).empty()) {
+                result_ = detail::add_sum(result_, sum_range_(Range(token)));
+            }
+        }
+    };
+
+    inline std::unique_ptr<aoc2025::StreamSolver> make_stream(int part) {
+        return std::make_unique<RangeStream>(part == 1 ? &detail::sum_part1 : &detail::sum_part2);
+    }
+
+    // Incremental solver: each range keeps its sums for both parts
+    namespace detail {
+        inline aoc2025::RecordSumSolver::Partials range_sums(std::string_view token) {
+            if (aoc2025::scan::trim(token).empty()) {
+                return {0, 0};
+            }
+            const Range range(token);
+            return {sum_part1(range), sum_part2(range)};
+        }
+    }
+
+    inline std::unique_ptr<aoc2025::IncrementalSolver> make_incremental() {
+        return std::make_unique<aoc2025::RecordSumSolver>(',', &detail::range_sums);
+    }
+
+#ifdef AOC2025_HAVE_INT128
+    // Solvers without allocation or exceptions, so answers for inputs known at
+    // compile time are computed by the compiler. nullopt on input the runtime
+    // parser would reject or a sum that overflows 64 bits.
+    namespace constant {
+        constexpr std::optional<std::int64_t> sum_ranges(std::string_view input, detail::Wide (*sum_range)(const Range&)) {
+            detail::Wide result = 0;
+            for (const std::string_view token : aoc2025::scan::split(input, ',')) {
+                if (aoc2025::scan::trim(token).empty()) {
+                    continue;
+                }
+                const std::optional<Range> range = Range::try_parse(token);
+                if (!range) {
+                    return std::nullopt;
+                }
+                result += sum_range(*range);
+                if (result > std::numeric_limits<std::int64_t>::max()) {
+                    return std::nullopt;
+                }
+            }
+            return static_cast<std::int64_t>(result);
+        }
+
+        constexpr std::optional<std::int64_t> answer_part1(std::string_view input) {
+            return sum_ranges(input, &detail::wide_sum_part1);
+        }
+
+        constexpr std::optional<std::int64_t> answer_part2(std::string_view input) {
+            return sum_ranges(input, &detail::wide_sum_part2);
+        }
+    }
+#endif
+
+    inline aoc2025::Answer answer_part1(const Ranges& ranges) {
+        return detail::solve_common(ranges, &detail::sum_part1);
+    }
+
+    inline aoc2025::Answer answer_part2(const Ranges& ranges) {
+        return detail::solve_common(ranges, &detail::sum_part2);
+    }
+
+    inline aoc2025::Answer answer_part1(std::string_view input) {
+        return answer_part1(Ranges(input));
+    }
+
+    inline aoc2025::Answer answer_part2(std::string_view input) {
+        return answer_part2(Ranges(input));
+    }
+
+    inline std::ostream& solve_part1(std::ostream& os, std::string_view input) {
+        os << answer_part1(input);
         return os;
     }
 
-    inline std::ostream& solve_part2(std::ostream& os, const std::string& input) {
-        os << detail::solve_common(input, Part2IdOfConcern);
+    inline std::ostream& solve_part2(std::ostream& os, std::string_view input) {
+        os << answer_part2(input);
         return os;
     }
 
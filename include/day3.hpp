@@ -7,36 +7,121 @@
 #include <stdexcept>
 #include <cstdint>
 #include <algorithm>
-#include <cctype>
+#include <array>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
 
 #include "aoc2025.hpp"
+#include "kernels.hpp"
+#include "scan.hpp"
+#include "trace.hpp"
 
 namespace Day3 {
 
+    namespace detail {
+        // Digit values from either parsed digits or ASCII text, so the selection
+        // below runs on a Bank at run time and straight on the input in
+        // constant expressions
+        constexpr std::uint8_t digit_value(std::uint8_t digit) { return digit; }
+        constexpr std::uint8_t digit_value(char ch) { return static_cast<std::uint8_t>(ch - '0'); }
+
+        constexpr bool is_digit(char ch) { return ch >= '0' && ch <= '9'; }
+
+        template <typename Digits>
+        constexpr std::int64_t max_pair(const Digits& digits) {
+            if (digits.size() < 2) {
+                return 0;
+            }
+
+            // Find the index of the max element in range [0, len-1)
+            const auto first_range_end = digits.end() - 1;
+            const auto max_it = std::max_element(digits.begin(), first_range_end);
+
+            // Find the max element in range [maxIdx+1, len)
+            const auto max_second_it = std::max_element(max_it + 1, digits.end());
+
+            return static_cast<std::int64_t>(digit_value(*max_it)) * 10 +
+                   static_cast<std::int64_t>(digit_value(*max_second_it));
+        }
+
+        // Greedy with a stack: a digit evicts smaller digits before it while
+        // enough digits remain to still pick n, which is optimal and linear
+        template <typename Digits>
+        constexpr std::int64_t max_n(const Digits& digits, std::size_t n) {
+            if (n == 0 || n > digits.size()) {
+                return 0;
+            }
+            std::array<std::uint8_t, 64> kept_small{};
+            std::vector<std::uint8_t> kept_large;
+            std::uint8_t* kept = kept_small.data();
+            if (n > kept_small.size()) {
+                kept_large.resize(n);
+                kept = kept_large.data();
+            }
+
+            std::size_t size = 0;
+            std::size_t droppable = digits.size() - n;
+            for (const auto element : digits) {
+                const std::uint8_t digit = digit_value(element);
+                while (size > 0 && droppable > 0 && kept[size - 1] < digit) {
+                    --size;
+                    --droppable;
+                }
+                if (size < n) {
+                    kept[size++] = digit;
+                } else {
+                    --droppable;
+                }
+            }
+
+            std::int64_t result = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                result = result * 10 + kept[i];
+            }
+            return result;
+        }
+    }
+
     // Bank represents one line of input as an array of digits
     class Bank {
-        std::vector<std::uint8_t> digits_;
+        std::pmr::vector<std::uint8_t> digits_;
 
     public:
+        // Allocator-aware, so banks stored in a pmr container keep their digits
+        // in the same memory resource
+        using allocator_type = std::pmr::polymorphic_allocator<std::uint8_t>;
+
         // Create a Bank from a string of digits
         // Rejects non-digit characters
-        explicit Bank(std::string_view input_string) {
-            if (!std::all_of(input_string.begin(), input_string.end(), 
-                           [](char ch) { return std::isdigit(static_cast<unsigned char>(ch)); })) {
+        explicit Bank(std::string_view input_string, const allocator_type& allocator = {})
+            : digits_(input_string.size(), allocator) {
+            if (!aoc2025::kernels::digits_from_text(input_string, digits_.data())) {
                 throw std::invalid_argument("Input contains non-digit characters");
             }
+        }
 
-            digits_.reserve(input_string.length());
-            std::transform(input_string.begin(), input_string.end(), 
-                         std::back_inserter(digits_),
-                         [](char ch) { return static_cast<std::uint8_t>(ch - '0'); });
+        // From digit values 0-9 rather than text, e.g. from a binary model
+        explicit Bank(std::span<const std::uint8_t> digits, const allocator_type& allocator = {})
+            : digits_(digits.begin(), digits.end(), allocator) {
+            if (!std::all_of(digits.begin(), digits.end(), [](std::uint8_t digit) { return digit <= 9; })) {
+                throw std::invalid_argument("Digit values must be 0-9");
+            }
         }
 
         explicit Bank(const std::string& input_string) : Bank(std::string_view(input_string)) {}
         explicit Bank(const char* input_string) : Bank(std::string_view(input_string)) {}
 
+        Bank(const Bank&) = default;
+        Bank(Bank&&) = default;
+        Bank& operator=(const Bank&) = default;
+        Bank& operator=(Bank&&) = default;
+        Bank(const Bank& other, const allocator_type& allocator) : digits_(other.digits_, allocator) {}
+        Bank(Bank&& other, const allocator_type& allocator) : digits_(std::move(other.digits_), allocator) {}
+
         // Get the underlying digits
-        const std::vector<std::uint8_t>& get_digits() const { return digits_; }
+        const std::pmr::vector<std::uint8_t>& get_digits() const { return digits_; }
         std::size_t size() const { return digits_.size(); }
         bool empty() const { return digits_.empty(); }
 
@@ -46,56 +131,43 @@ namespace Day3 {
             if (digits_.size() < 2) {
                 return 0;
             }
-
-            // Find the index of the max element in range [0, len-1)
-            const auto first_range_end = digits_.end() - 1;
-            const auto max_it = std::max_element(digits_.begin(), first_range_end);
-            const std::size_t max_idx = static_cast<std::size_t>(std::distance(digits_.begin(), max_it));
-
-            // Find the max element in range [maxIdx+1, len)
-            const auto second_range_begin = digits_.begin() + static_cast<std::ptrdiff_t>(max_idx + 1);
-            const auto max_second_it = std::max_element(second_range_begin, digits_.end());
-            const std::size_t max_second_idx = static_cast<std::size_t>(std::distance(digits_.begin(), max_second_it));
-
-            return static_cast<std::int64_t>(digits_[max_idx]) * 10 + 
-                   static_cast<std::int64_t>(digits_[max_second_idx]);
+            // The first occurrence of the largest digit before the last, then
+            // the largest digit after it
+            const std::uint8_t* data = digits_.data();
+            const std::size_t size = digits_.size();
+            const std::uint8_t first = aoc2025::kernels::max_value(data, size - 1);
+            const std::uint8_t* first_at = std::find(data, data + size - 1, first);
+            const std::uint8_t second = aoc2025::kernels::max_value(first_at + 1, static_cast<std::size_t>(data + size - first_at - 1));
+            return static_cast<std::int64_t>(first) * 10 + static_cast<std::int64_t>(second);
         }
 
         // Returns the n largest digits in order of appearance, as a number
-        // Uses recursive approach: for each possible first digit position in range [0, len-n],
-        // find the max digit, then recursively solve for remaining (n-1) digits after it
         std::int64_t max_n(std::size_t n) const {
-            if (n == 0 || n > digits_.size()) {
-                return 0;
-            }
-            return max_n_helper(n, 0);
-        }
-
-    private:
-        static constexpr std::int64_t power_of_10(std::size_t power) {
-            std::int64_t result = 1;
-            for (std::size_t i = 0; i < power; ++i) {
-                result *= 10;
-            }
-            return result;
+            return detail::max_n(digits_, n);
         }
+    };
 
-        std::int64_t max_n_helper(std::size_t n, std::size_t start_idx) const {
-            if (n == 0 || start_idx >= digits_.size()) {
+    namespace reference {
+        // The original recursive max_n, kept as the oracle for Bank::max_n: for
+        // each position pick the largest digit that still leaves room for the
+        // remaining ones, then recurse on the digits after it
+        inline std::int64_t max_n_helper(const std::pmr::vector<std::uint8_t>& digits, std::size_t n,
+                                         std::size_t start_idx) {
+            if (n == 0 || start_idx >= digits.size()) {
                 return 0;
             }
 
             // Need n digits, so first digit can be at most at position len - n
-            const std::size_t end_search_pos = digits_.size() - n;
+            const std::size_t end_search_pos = digits.size() - n;
             if (end_search_pos < start_idx) {
                 return 0;
             }
 
             // Find the maximum digit in the valid range using std::max_element
-            const auto range_begin = digits_.begin() + static_cast<std::ptrdiff_t>(start_idx);
-            const auto range_end = digits_.begin() + static_cast<std::ptrdiff_t>(end_search_pos + 1);
+            const auto range_begin = digits.begin() + static_cast<std::ptrdiff_t>(start_idx);
+            const auto range_end = digits.begin() + static_cast<std::ptrdiff_t>(end_search_pos + 1);
             const auto max_it = std::max_element(range_begin, range_end);
-            const std::size_t max_pos = static_cast<std::size_t>(std::distance(digits_.begin(), max_it));
+            const std::size_t max_pos = static_cast<std::size_t>(std::distance(digits.begin(), max_it));
             const std::uint8_t max_digit = *max_it;
 
             // Use this digit and recursively find the best (n-1) digits after it
@@ -103,79 +175,210 @@ namespace Day3 {
                 return static_cast<std::int64_t>(max_digit);
             }
 
-            const std::int64_t remaining = max_n_helper(n - 1, max_pos + 1);
-            // Compute 10^(n-1) as integer
-            const std::int64_t multiplier = power_of_10(n - 1);
+            const std::int64_t remaining = max_n_helper(digits, n - 1, max_pos + 1);
+            std::int64_t multiplier = 1;
+            for (std::size_t i = 1; i < n; ++i) {
+                multiplier *= 10;
+            }
 
             return static_cast<std::int64_t>(max_digit) * multiplier + remaining;
         }
-    };
 
-    namespace detail {
-        // Helper function to trim whitespace from a string view
-        inline std::string_view trim_whitespace(std::string_view str) {
-            const auto first = str.find_first_not_of(" \t\r\n");
-            if (first == std::string_view::npos) {
-                return {};
+        inline std::int64_t max_n(const Bank& bank, std::size_t n) {
+            if (n == 0 || n > bank.size()) {
+                return 0;
             }
-            const auto last = str.find_last_not_of(" \t\r\n");
-            return str.substr(first, last - first + 1);
+            return max_n_helper(bank.get_digits(), n, 0);
         }
+    }
 
-        inline std::int64_t solve_part1(const std::string& input) {
-            std::int64_t result = 0;
-            std::istringstream input_stream(input);
-            std::string line;
+    // All valid banks of an input, one per line; blank and invalid lines are skipped
+    class Banks {
+        std::pmr::vector<Bank> banks_;
 
-            while (std::getline(input_stream, line)) {
-                const std::string_view trimmed = trim_whitespace(line);
+    public:
+        explicit Banks(std::string_view input_string,
+                       std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : banks_(resource) {
+            AOC2025_TRACE_ZONE("day3/parse");
+            banks_.reserve(aoc2025::scan::count_byte(input_string, '\n') + 1);
+            for (const std::string_view line : aoc2025::scan::lines(input_string)) {
+                const std::string_view trimmed = aoc2025::scan::trim(line);
                 if (trimmed.empty()) {
                     continue;
                 }
 
                 try {
-                    Bank bank(trimmed);
-                    result += bank.max_pair();
+                    banks_.emplace_back(trimmed);
                 } catch (const std::exception&) {
                     // Skip invalid lines
-                    continue;
                 }
             }
+        }
 
-            return result;
+        // Rebuild from the binary form written by save
+        Banks(aoc2025::binary::Reader& reader,
+              std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : banks_(resource) {
+            AOC2025_TRACE_ZONE("day3/load");
+            const std::size_t count = reader.get_count(8);
+            aoc2025::binary::Reader offsets(reader.get_bytes(count * 8));
+            const std::size_t total = reader.get_count(1);
+            const auto* digits = reinterpret_cast<const std::uint8_t*>(reader.get_bytes(total).data());
+            banks_.reserve(count);
+            std::uint64_t begin = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                const std::uint64_t end = offsets.get_u64();
+                if (end < begin || end > total) {
+                    throw std::runtime_error("Binary model has a bank outside its digits");
+                }
+                banks_.emplace_back(std::span<const std::uint8_t>(digits + begin, digits + end));
+                begin = end;
+            }
         }
 
-        inline std::int64_t solve_part2(const std::string& input) {
-            std::int64_t result = 0;
-            std::istringstream input_stream(input);
-            std::string line;
+        // Binary form: the count, the end offset of each bank in the digit
+        // block, then the digit values of every bank back to back
+        void save(std::string& out) const {
+            aoc2025::binary::Writer writer(out);
+            writer.put_u64(banks_.size());
+            std::uint64_t end = 0;
+            for (const Bank& bank : banks_) {
+                end += bank.size();
+                writer.put_u64(end);
+            }
+            writer.put_u64(end);
+            for (const Bank& bank : banks_) {
+                const auto& digits = bank.get_digits();
+                writer.put_bytes(std::string_view(reinterpret_cast<const char*>(digits.data()), digits.size()));
+            }
+        }
 
-            while (std::getline(input_stream, line)) {
-                const std::string_view trimmed = trim_whitespace(line);
-                if (trimmed.empty()) {
-                    continue;
-                }
+        auto begin() const { return banks_.begin(); }
+        auto end() const { return banks_.end(); }
+        const std::pmr::vector<Bank>& get() const { return banks_; }
+    };
 
-                try {
-                    Bank bank(trimmed);
-                    result += bank.max_n(12);
-                } catch (const std::exception&) {
-                    // Skip invalid lines
+    // Streaming solver: scores each bank as soon as its line is complete, with
+    // the same skipping rules as Banks
+    class BankStream : public aoc2025::StreamSolver {
+        std::size_t digits_;
+        aoc2025::RecordSplitter lines_{'\n'};
+        std::int64_t result_ = 0;
+
+    public:
+        // digits is 2 for part 1 and 12 for part 2
+        explicit BankStream(std::size_t digits) : digits_(digits) {}
+
+        void feed(std::string_view chunk) override {
+            lines_.feed(chunk, [this](std::string_view line) { add(line); });
+        }
+
+        aoc2025::Answer finish() override {
+            lines_.finish([this](std::string_view line) { add(line); });
+            return result_;
+        }
+
+    private:
+        void add(std::string_view line) {
+            const std::string_view trimmed = aoc2025::scan::trim(line);
+            if (trimmed.empty()) {
+                return;
+            }
+
+            try {
+                const Bank bank(trimmed);
+                result_ += digits_ == 2 ? bank.max_pair() : bank.max_n(digits_);
+            } catch (const std::exception&) {
+                // Skip invalid lines
+            }
+        }
+    };
+
+    inline std::unique_ptr<aoc2025::StreamSolver> make_stream(int part) {
+        return std::make_unique<BankStream>(part == 1 ? 2 : 12);
+    }
+
+    // Incremental solver: each line keeps its joltage for both parts
+    namespace detail {
+        inline aoc2025::RecordSumSolver::Partials bank_sums(std::string_view line) {
+            const std::string_view trimmed = aoc2025::scan::trim(line);
+            if (trimmed.empty()) {
+                return {0, 0};
+            }
+            try {
+                const Bank bank(trimmed);
+                return {bank.max_pair(), bank.max_n(12)};
+            } catch (const std::exception&) {
+                // Skipped like in Banks
+                return {0, 0};
+            }
+        }
+    }
+
+    inline std::unique_ptr<aoc2025::IncrementalSolver> make_incremental() {
+        return std::make_unique<aoc2025::RecordSumSolver>('\n', &detail::bank_sums);
+    }
+
+    // Solvers without allocation or exceptions, so answers for inputs known at
+    // compile time are computed by the compiler. Lines are skipped by the same
+    // rules as Banks.
+    namespace constant {
+        // digits is 2 for part 1 and 12 for part 2
+        constexpr std::optional<std::int64_t> sum_banks(std::string_view input, std::size_t digits) {
+            std::int64_t result = 0;
+            for (const std::string_view line : aoc2025::scan::lines(input)) {
+                const std::string_view trimmed = aoc2025::scan::trim(line);
+                if (trimmed.empty() || !std::all_of(trimmed.begin(), trimmed.end(), detail::is_digit)) {
                     continue;
                 }
+                result += digits == 2 ? detail::max_pair(trimmed) : detail::max_n(trimmed, digits);
             }
-
             return result;
         }
+
+        constexpr std::optional<std::int64_t> answer_part1(std::string_view input) {
+            return sum_banks(input, 2);
+        }
+
+        constexpr std::optional<std::int64_t> answer_part2(std::string_view input) {
+            return sum_banks(input, 12);
+        }
+    }
+
+    inline aoc2025::Answer answer_part1(const Banks& banks) {
+        AOC2025_TRACE_ZONE("day3/solve");
+        std::int64_t result = 0;
+        for (const auto& bank : banks) {
+            result += bank.max_pair();
+        }
+        return result;
+    }
+
+    inline aoc2025::Answer answer_part2(const Banks& banks) {
+        AOC2025_TRACE_ZONE("day3/solve");
+        std::int64_t result = 0;
+        for (const auto& bank : banks) {
+            result += bank.max_n(12);
+        }
+        return result;
+    }
+
+    inline aoc2025::Answer answer_part1(std::string_view input) {
+        return answer_part1(Banks(input));
+    }
+
+    inline aoc2025::Answer answer_part2(std::string_view input) {
+        return answer_part2(Banks(input));
     }
 
-    inline std::ostream& solve_part1(std::ostream& os, const std::string& input) {
-        os << detail::solve_part1(input);
+    inline std::ostream& solve_part1(std::ostream& os, std::string_view input) {
+        os << answer_part1(input);
         return os;
     }
 
-    inline std::ostream& solve_part2(std::ostream& os, const std::string& input) {
-        os << detail::solve_part2(input);
+    inline std::ostream& solve_part2(std::ostream& os, std::string_view input) {
+        os << answer_part2(input);
         return os;
     }
 
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <optional>
+#include <string_view>
+
+#include "answer.hpp"
+
+namespace aoc2025::embedded {
+    // One dayN/data.txt compiled into the binary, see AOC2025_EMBED_INPUTS
+    struct EmbeddedInput {
+        int day_number;
+        std::string_view text;
+    };
+
+    // Whether this binary was configured with embedded inputs
+    bool enabled();
+
+    // The input compiled in for day, if any
+    std::optional<std::string_view> input(int day_number);
+
+    // The answer computed during compilation from the embedded input of day,
+    // if that input exists and the day has a constant-expression solver
+    std::optional<Answer> answer(int day_number, int part);
+}
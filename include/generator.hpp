@@ -0,0 +1,250 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace aoc2025::gen {
+    // SplitMix64: tiny, fast and identical on every platform, unlike the
+    // standard distributions whose output differs between library vendors
+    class Random {
+        std::uint64_t state_;
+
+    public:
+        explicit Random(std::uint64_t seed) : state_(seed) {}
+
+        std::uint64_t next() {
+            std::uint64_t z = (state_ += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+        // Uniform value in [low, high]
+        std::uint64_t between(std::uint64_t low, std::uint64_t high) {
+            const std::uint64_t span = high - low + 1;
+            if (span == 0) {
+                return next();
+            }
+            // Modulo bias is below 2^-40 for the spans used here
+            return low + next() % span;
+        }
+    };
+
+    // Buffered output that either streams to a FILE* or appends to a string
+    class Writer {
+        std::FILE* file_ = nullptr;
+        std::string* target_ = nullptr;
+        std::vector<char> buffer_;
+        std::size_t used_ = 0;
+        std::uint64_t written_ = 0;
+
+    public:
+        static constexpr std::size_t kBufferSize = std::size_t{1} << 20;
+
+        explicit Writer(std::FILE* file) : file_(file), buffer_(kBufferSize) {}
+        explicit Writer(std::string& target) : target_(&target), buffer_(kBufferSize) {}
+
+        // Flushes what is left but swallows write errors, since a destructor
+        // must not throw; call flush() first to see them
+        ~Writer() {
+            try {
+                flush();
+            } catch (const std::exception&) {
+            }
+        }
+
+        Writer(const Writer&) = delete;
+        Writer& operator=(const Writer&) = delete;
+
+        void put(char ch) {
+            if (used_ == buffer_.size()) {
+                flush();
+            }
+            buffer_[used_++] = ch;
+            ++written_;
+        }
+
+        void append(std::string_view text) {
+            if (buffer_.size() - used_ < text.size()) {
+                flush();
+            }
+            if (text.size() > buffer_.size()) {
+                for (const char ch : text) {
+                    put(ch);
+                }
+                return;
+            }
+            std::memcpy(buffer_.data() + used_, text.data(), text.size());
+            used_ += text.size();
+            written_ += text.size();
+        }
+
+        void append_number(std::uint64_t value) {
+            std::array<char, 20> digits{};
+            const auto [end, ec] = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+            append(std::string_view(digits.data(), static_cast<std::size_t>(end - digits.data())));
+        }
+
+        // Total bytes produced so far, flushed or not
+        std::uint64_t written() const { return written_; }
+
+        void flush() {
+            if (used_ == 0) {
+                return;
+            }
+            if (file_ != nullptr) {
+                if (std::fwrite(buffer_.data(), 1, used_, file_) != used_) {
+                    throw std::runtime_error("Failed to write generated input");
+                }
+            } else if (target_ != nullptr) {
+                target_->append(buffer_.data(), used_);
+            }
+            used_ = 0;
+        }
+    };
+
+    struct Options {
+        std::uint64_t seed = 2025;
+        std::uint64_t bytes = 1 << 20;
+
+        // Day 1: largest rotation, DialRotation stores steps in 16 bits
+        std::uint64_t max_steps = 99;
+
+        // Day 2: widest range (end - start), percentage of ranges that overlap
+        // their predecessor, and number of digits of range starts
+        std::uint64_t range_width = 1000;
+        std::uint64_t overlap_percent = 0;
+        std::uint64_t max_digits = 10;
+
+        // Day 3: digits per bank and relative weight of each digit 0-9
+        std::uint64_t line_length = 100;
+        std::array<std::uint32_t, 10> digit_weights = {0, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+    };
+
+    namespace detail {
+        inline std::uint64_t power_of_10(std::uint64_t power) {
+            std::uint64_t result = 1;
+            for (std::uint64_t i = 0; i < power; ++i) {
+                result *= 10;
+            }
+            return result;
+        }
+    }
+
+    // "L68\n"-style rotation log
+    inline void day1(Writer& out, const Options& options) {
+        Random rng(options.seed);
+        const std::uint64_t max_steps = std::clamp<std::uint64_t>(options.max_steps, 1, std::numeric_limits<std::uint16_t>::max());
+        while (out.written() < options.bytes) {
+            out.put((rng.next() & 1) ? 'R' : 'L');
+            out.append_number(rng.between(1, max_steps));
+            out.put('\n');
+        }
+    }
+
+    // Single line of comma-separated "start-end" ranges
+    inline void day2(Writer& out, const Options& options) {
+        Random rng(options.seed);
+        const std::uint64_t digits = std::clamp<std::uint64_t>(options.max_digits, 1, 17);
+        const std::uint64_t max_start = detail::power_of_10(digits) - 1;
+        if (options.range_width > std::numeric_limits<std::uint64_t>::max() - max_start) {
+            throw std::invalid_argument("Range width " + std::to_string(options.range_width) +
+                                        " overflows ranges starting at up to " + std::to_string(digits) + " digits");
+        }
+        std::uint64_t previous_start = 1;
+        std::uint64_t previous_end = 1;
+        bool first = true;
+        while (out.written() < options.bytes) {
+            std::uint64_t start = rng.between(1, max_start);
+            if (!first && rng.between(1, 100) <= options.overlap_percent) {
+                start = rng.between(previous_start, previous_end);
+            }
+            const std::uint64_t end = start + rng.between(0, options.range_width);
+            if (!first) {
+                out.put(',');
+            }
+            out.append_number(start);
+            out.put('-');
+            out.append_number(end);
+            previous_start = start;
+            previous_end = end;
+            first = false;
+        }
+        out.put('\n');
+    }
+
+    // Lines of line_length digits drawn from digit_weights
+    inline void day3(Writer& out, const Options& options) {
+        // Lookup table of 1024 slots apportioned by weight, sampled with 10 random bits
+        std::array<char, 1024> table{};
+        std::uint64_t total = 0;
+        for (const auto weight : options.digit_weights) {
+            total += weight;
+        }
+        if (total == 0) {
+            throw std::invalid_argument("At least one digit weight must be positive");
+        }
+        std::size_t slot = 0;
+        std::uint64_t cumulative = 0;
+        for (std::size_t digit = 0; digit < options.digit_weights.size(); ++digit) {
+            cumulative += options.digit_weights[digit];
+            const std::size_t until = static_cast<std::size_t>(cumulative * table.size() / total);
+            for (; slot < until; ++slot) {
+                table[slot] = static_cast<char>('0' + digit);
+            }
+        }
+
+        Random rng(options.seed);
+        const std::uint64_t line_length = std::max<std::uint64_t>(options.line_length, 1);
+        while (out.written() < options.bytes) {
+            std::uint64_t bits = 0;
+            int bits_left = 0;
+            for (std::uint64_t i = 0; i < line_length; ++i) {
+                if (bits_left < 10) {
+                    bits = rng.next();
+                    bits_left = 64;
+                }
+                out.put(table[bits & 1023]);
+                bits >>= 10;
+                bits_left -= 10;
+            }
+            out.put('\n');
+        }
+    }
+
+    using GeneratorFunction = void (*)(Writer&, const Options&);
+
+    // Generators by day number
+    inline const std::map<int, GeneratorFunction>& generators() {
+        static const std::map<int, GeneratorFunction> registry{
+            {1, &day1},
+            {2, &day2},
+            {3, &day3},
+        };
+        return registry;
+    }
+
+    // Convenience for in-memory use, e.g. benchmarks and tests
+    inline std::string generate(int day_number, const Options& options) {
+        const auto it = generators().find(day_number);
+        if (it == generators().end()) {
+            throw std::invalid_argument("No generator for day " + std::to_string(day_number));
+        }
+        std::string result;
+        result.reserve(static_cast<std::size_t>(options.bytes) + 64);
+        Writer out(result);
+        it->second(out, options);
+        out.flush();
+        return result;
+    }
+}
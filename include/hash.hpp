@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace aoc2025 {
+    namespace detail {
+        constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+        constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+        constexpr std::uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+        constexpr std::uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+        constexpr std::uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+        inline std::uint64_t rotl(std::uint64_t value, int bits) {
+            return (value << bits) | (value >> (64 - bits));
+        }
+
+        inline std::uint64_t read64(const char* p) {
+            std::uint64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        inline std::uint32_t read32(const char* p) {
+            std::uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        inline std::uint64_t hash_round(std::uint64_t acc, std::uint64_t input) {
+            acc += input * kPrime2;
+            acc = rotl(acc, 31);
+            return acc * kPrime1;
+        }
+
+        inline std::uint64_t hash_merge(std::uint64_t acc, std::uint64_t value) {
+            acc ^= hash_round(0, value);
+            return acc * kPrime1 + kPrime4;
+        }
+    }
+
+    // XXH64 of bytes (little-endian reads). Four independent lanes keep it
+    // memory-bound on large inputs.
+    inline std::uint64_t hash_bytes(std::string_view bytes, std::uint64_t seed = 0) {
+        using namespace detail;
+        const char* p = bytes.data();
+        const char* const end = p + bytes.size();
+        std::uint64_t hash;
+
+        if (bytes.size() >= 32) {
+            std::uint64_t v1 = seed + kPrime1 + kPrime2;
+            std::uint64_t v2 = seed + kPrime2;
+            std::uint64_t v3 = seed;
+            std::uint64_t v4 = seed - kPrime1;
+            const char* const limit = end - 32;
+            do {
+                v1 = hash_round(v1, read64(p));
+                v2 = hash_round(v2, read64(p + 8));
+                v3 = hash_round(v3, read64(p + 16));
+                v4 = hash_round(v4, read64(p + 24));
+                p += 32;
+            } while (p <= limit);
+
+            hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+            hash = hash_merge(hash, v1);
+            hash = hash_merge(hash, v2);
+            hash = hash_merge(hash, v3);
+            hash = hash_merge(hash, v4);
+        } else {
+            hash = seed + kPrime5;
+        }
+
+        hash += static_cast<std::uint64_t>(bytes.size());
+
+        for (; p + 8 <= end; p += 8) {
+            hash ^= hash_round(0, read64(p));
+            hash = rotl(hash, 27) * kPrime1 + kPrime4;
+        }
+        if (p + 4 <= end) {
+            hash ^= static_cast<std::uint64_t>(read32(p)) * kPrime1;
+            hash = rotl(hash, 23) * kPrime2 + kPrime3;
+            p += 4;
+        }
+        for (; p < end; ++p) {
+            hash ^= static_cast<std::uint64_t>(static_cast<unsigned char>(*p)) * kPrime5;
+            hash = rotl(hash, 11) * kPrime1;
+        }
+
+        hash ^= hash >> 33;
+        hash *= kPrime2;
+        hash ^= hash >> 29;
+        hash *= kPrime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+}
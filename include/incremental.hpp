@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "answer.hpp"
+#include "scan.hpp"
+
+namespace aoc2025 {
+    // A change to an input: erased bytes at offset replaced by inserted
+    struct Edit {
+        std::size_t offset = 0;
+        std::size_t erased = 0;
+        std::string_view inserted;
+    };
+
+    // Smallest single edit turning before into after: everything between the
+    // common prefix and the common suffix. Compares a block at a time, so it
+    // runs at memory bandwidth however large the inputs are.
+    inline Edit diff(std::string_view before, std::string_view after) {
+        constexpr std::size_t kBlock = 4096;
+        const std::size_t limit = std::min(before.size(), after.size());
+        std::size_t prefix = 0;
+        while (prefix + kBlock <= limit && std::memcmp(before.data() + prefix, after.data() + prefix, kBlock) == 0) {
+            prefix += kBlock;
+        }
+        while (prefix < limit && before[prefix] == after[prefix]) {
+            ++prefix;
+        }
+        // The suffix may not reach back into the prefix of either side
+        const std::size_t suffix_limit = limit - prefix;
+        std::size_t suffix = 0;
+        while (suffix + kBlock <= suffix_limit &&
+               std::memcmp(before.data() + before.size() - suffix - kBlock,
+                           after.data() + after.size() - suffix - kBlock, kBlock) == 0) {
+            suffix += kBlock;
+        }
+        while (suffix < suffix_limit && before[before.size() - suffix - 1] == after[after.size() - suffix - 1]) {
+            ++suffix;
+        }
+        return Edit{prefix, before.size() - prefix - suffix, after.substr(prefix, after.size() - prefix - suffix)};
+    }
+
+    // Delimiter-separated records of an input, each with a per-record result
+    // of type Partial, kept up to date across edits. A record includes its
+    // delimiter; the last one may lack it. Only records an edit touches are
+    // rebuilt; the rest keep their results and just move.
+    template <typename Partial>
+    class RecordIndex {
+        char delimiter_;
+        std::vector<std::uint64_t> starts_;
+        std::vector<Partial> partials_;
+
+    public:
+        // Records [first, first + removed) were replaced by [first, first + added)
+        struct Splice {
+            std::size_t first = 0;
+            std::size_t removed = 0;
+            std::size_t added = 0;
+        };
+
+        explicit RecordIndex(char delimiter) : delimiter_(delimiter) {}
+
+        std::size_t size() const { return partials_.size(); }
+        Partial& operator[](std::size_t index) { return partials_[index]; }
+        const Partial& operator[](std::size_t index) const { return partials_[index]; }
+
+        // text is the input after an edit that replaced erased bytes at offset
+        // with inserted new ones. Re-split the records the edit touches and
+        // build each new record's result with make(record without delimiter).
+        // All of that happens before anything changes, so a make that throws
+        // leaves the index as it was; then retire(result) is called for each
+        // replaced record.
+        template <typename Make, typename Retire>
+        Splice apply(std::string_view text, std::size_t offset, std::size_t erased, std::size_t inserted,
+                     Make&& make, Retire&& retire) {
+            const std::size_t old_size = text.size() + erased - inserted;
+            const std::size_t count = starts_.size();
+            auto old_start = [&](std::size_t index) -> std::size_t {
+                return index < count ? static_cast<std::size_t>(starts_[index]) : old_size;
+            };
+
+            std::size_t first = 0;
+            std::size_t last = 0;
+            if (offset == old_size && offset > 0 && text[offset - 1] == delimiter_) {
+                // Appending after a complete record leaves it alone
+                first = count;
+                last = count;
+            } else if (count > 0) {
+                first = record_at(std::min(offset, old_size - 1));
+                last = record_at(std::min(offset + std::max<std::size_t>(erased, 1) - 1, old_size - 1)) + 1;
+            }
+            const std::size_t begin = old_start(first);
+            std::size_t end = old_start(last) + inserted - erased;
+            // A record whose delimiter was erased runs on into the next one
+            while (last < count && end > begin && text[end - 1] != delimiter_) {
+                ++last;
+                end = old_start(last) + inserted - erased;
+            }
+
+            std::vector<std::uint64_t> starts;
+            std::vector<Partial> partials;
+            for (std::size_t at = begin; at < end;) {
+                const std::size_t found = scan::find_byte(text.substr(at, end - at), delimiter_);
+                const std::size_t length = found == std::string_view::npos ? end - at : found;
+                starts.push_back(at);
+                partials.push_back(make(text.substr(at, length)));
+                at += found == std::string_view::npos ? length : length + 1;
+            }
+
+            for (std::size_t i = first; i < last; ++i) {
+                retire(partials_[i]);
+            }
+            splice(starts_, first, last, starts);
+            splice(partials_, first, last, partials);
+            for (std::size_t i = first + starts.size(); i < starts_.size(); ++i) {
+                starts_[i] = starts_[i] + inserted - erased;
+            }
+            return Splice{first, last - first, starts.size()};
+        }
+
+    private:
+        // Overwrite what overlaps and move the tail once, so an edit that
+        // keeps the number of records moves nothing
+        template <typename T>
+        static void splice(std::vector<T>& values, std::size_t first, std::size_t last, std::vector<T>& replacement) {
+            const std::size_t overlap = std::min(last - first, replacement.size());
+            std::move(replacement.begin(), replacement.begin() + static_cast<std::ptrdiff_t>(overlap),
+                      values.begin() + static_cast<std::ptrdiff_t>(first));
+            if (values.size() + replacement.size() - overlap > values.capacity()) {
+                // An eighth spare instead of doubling: indexes of large inputs
+                // are big, and edits rarely add many records
+                values.reserve(values.size() + values.size() / 8 + replacement.size());
+            }
+            const auto at = values.begin() + static_cast<std::ptrdiff_t>(first + overlap);
+            if (overlap < replacement.size()) {
+                values.insert(at, std::make_move_iterator(replacement.begin() + static_cast<std::ptrdiff_t>(overlap)),
+                              std::make_move_iterator(replacement.end()));
+            } else {
+                values.erase(at, at + static_cast<std::ptrdiff_t>(last - first - overlap));
+            }
+        }
+
+        std::size_t record_at(std::size_t offset) const {
+            return static_cast<std::size_t>(std::upper_bound(starts_.begin(), starts_.end(), offset) - starts_.begin()) - 1;
+        }
+    };
+
+    // Solver that keeps its model and partial results between versions of an
+    // input, so after an edit it re-solves only what the edit affects. Both
+    // parts are kept up to date together.
+    class IncrementalSolver {
+        std::string text_;
+
+    public:
+        virtual ~IncrementalSolver() = default;
+
+        // Move to a new version of the input, comparing it with the last one
+        // to find what changed; returns the number of records re-solved
+        std::size_t update(std::string_view input) {
+            return apply(diff(text_, input));
+        }
+
+        // Apply an edit known to the caller, skipping the comparison; throws
+        // std::out_of_range for an edit beyond the input, and leaves the
+        // solver unchanged if the edited input does not parse
+        std::size_t apply(const Edit& edit) {
+            if (edit.offset > text_.size() || edit.erased > text_.size() - edit.offset) {
+                throw std::out_of_range("Edit beyond the end of the input");
+            }
+            if (edit.erased == 0 && edit.inserted.empty()) {
+                return 0;
+            }
+            // Edited in place, which moves the tail once instead of copying
+            // the whole input, and undone if the edited input is rejected
+            const std::string erased = text_.substr(edit.offset, edit.erased);
+            text_.replace(edit.offset, edit.erased, edit.inserted);
+            try {
+                return on_edit(text_, edit.offset, edit.erased, edit.inserted.size());
+            } catch (...) {
+                text_.replace(edit.offset, edit.inserted.size(), erased);
+                throw;
+            }
+        }
+
+        std::string_view text() const { return text_; }
+
+        virtual Answer answer(int part) const = 0;
+
+    protected:
+        // text is the whole input after the edit; returns records re-solved
+        virtual std::size_t on_edit(std::string_view text, std::size_t offset, std::size_t erased,
+                                    std::size_t inserted) = 0;
+    };
+
+    // Incremental solver for days whose answers are sums over records (see
+    // Day::shard_delimiter): each record keeps its answers to both parts and
+    // an edit swaps the touched records' answers out of the totals
+    class RecordSumSolver : public IncrementalSolver {
+    public:
+        using Partials = std::array<std::int64_t, 2>;
+        using RecordFunction = Partials(*)(std::string_view record);
+
+        RecordSumSolver(char delimiter, RecordFunction solve_record)
+            : records_(delimiter), solve_record_(solve_record) {}
+
+        Answer answer(int part) const override {
+            return totals_[part == 1 ? 0 : 1];
+        }
+
+    protected:
+        std::size_t on_edit(std::string_view text, std::size_t offset, std::size_t erased,
+                            std::size_t inserted) override {
+            Partials added{};
+            const auto splice = records_.apply(text, offset, erased, inserted,
+                [&](std::string_view record) {
+                    const Partials partials = solve_record_(record);
+                    added[0] += partials[0];
+                    added[1] += partials[1];
+                    return partials;
+                },
+                [&](const Partials& partials) {
+                    totals_[0] -= partials[0];
+                    totals_[1] -= partials[1];
+                });
+            totals_[0] += added[0];
+            totals_[1] += added[1];
+            return splice.added;
+        }
+
+    private:
+        RecordIndex<Partials> records_;
+        RecordFunction solve_record_;
+        Partials totals_{};
+    };
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace aoc2025 {
+    // Read-only puzzle input. Regular files are memory-mapped and handed out as a
+    // string_view without copying; pipes, character devices and platforms
+    // without mmap fall back to reading into an owned buffer. gzip and zstd
+    // files are recognised by their magic bytes and decompressed into an owned
+    // buffer (see compression.hpp).
+    class Input {
+        const char* data_ = nullptr;
+        std::size_t size_ = 0;
+        void* mapping_ = nullptr;
+        std::string owned_;
+        // Set by borrow: data_ points at text the caller keeps alive
+        bool borrowed_ = false;
+
+    public:
+        Input() = default;
+
+        // Wrap text that is already in memory, e.g. in tests
+        explicit Input(std::string contents);
+
+        // Refer to text that outlives the Input, e.g. an input embedded in the
+        // binary, without copying it
+        static Input borrow(std::string_view contents);
+
+        // Open a file, "-" reads standard input. Throws std::runtime_error on failure.
+        static Input open(const std::string& path);
+
+        // Open a file as stored, leaving gzip and zstd data compressed, e.g. to
+        // hand out byte ranges of it
+        static Input open_raw(const std::string& path);
+
+        ~Input();
+
+        Input(Input&& other) noexcept;
+        Input& operator=(Input&& other) noexcept;
+        Input(const Input&) = delete;
+        Input& operator=(const Input&) = delete;
+
+        std::string_view view() const { return {data_, size_}; }
+        operator std::string_view() const { return view(); }
+
+        std::size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+        bool is_mapped() const { return mapping_ != nullptr; }
+
+    private:
+        static Input decompressed(Input input);
+        void release();
+    };
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "cpu.hpp"
+
+namespace aoc2025::kernels {
+    // Hot loops compiled once per cpu::Level and dispatched through a table
+    // resolved on first use from cpu::active(). Each has a portable body the
+    // compiler vectorises for the wider instruction sets; see src/kernels.cpp.
+
+    // Digit values of text into out (text.size() bytes); false if any byte is
+    // not an ASCII digit, in which case out holds garbage
+    bool digits_from_text(std::string_view text, std::uint8_t* out);
+
+    // Largest of size bytes, 0 when size is 0
+    std::uint8_t max_value(const std::uint8_t* data, std::size_t size);
+
+    // The tier the table was resolved for
+    cpu::Level level();
+}
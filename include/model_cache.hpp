@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "aoc2025.hpp"
+
+namespace aoc2025 {
+    // What a sidecar was written from; it is reused only when all of it matches
+    struct SidecarKey {
+        int day_number = 0;
+        std::string solver_version;
+        std::uint64_t input_size = 0;
+        std::int64_t input_mtime = 0;
+        std::uint64_t input_hash = 0;
+
+        // Key for the file at input whose bytes hash to input_hash; nullopt
+        // when the file cannot be stat'ed, e.g. stdin
+        static std::optional<SidecarKey> for_file(const Day& day, const std::filesystem::path& input,
+                                                  std::uint64_t input_hash);
+
+        bool operator==(const SidecarKey&) const = default;
+    };
+
+    // Pre-parsed models stored next to their input as INPUT.aocbin, so repeat
+    // runs skip parsing text. This is a copy-based cache: load maps the file,
+    // validates it and decodes the model into fresh memory (Day::load) rather
+    // than using the mapped bytes in place. The file
+    // is a versioned header holding the SidecarKey, then the day's binary
+    // model (Day::save); every field is little-endian.
+    namespace sidecar {
+        // Bump when the header or any day's binary model layout changes
+        inline constexpr std::uint32_t kFormatVersion = 2;
+
+        std::filesystem::path path_for(const std::filesystem::path& input);
+
+        // True for a sidecar or one of its temporaries, which input scans skip
+        bool is_sidecar(const std::filesystem::path& path);
+
+        std::string encode(const SidecarKey& key, std::string_view model_bytes);
+
+        // The model bytes of file if its header is intact and matches key
+        std::optional<std::string_view> decode(std::string_view file, const SidecarKey& key);
+
+        // The model stored for input, or null when there is no sidecar, it is
+        // stale or it is corrupt
+        Day::Model load(const Day& day, const std::filesystem::path& input, const SidecarKey& key);
+
+        // Best effort: a directory that cannot be written just means parsing
+        // again next time. Written to a temporary file and renamed into place.
+        bool store(const Day& day, const std::filesystem::path& input, const SidecarKey& key,
+                   const Day::Model& model);
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+#include <string>
+
+namespace aoc2025 {
+    enum class PerfEvent {
+        kCycles,
+        kInstructions,
+        kL1dMisses,
+        kLlcMisses,
+        kBranchMisses,
+        kPageFaults,
+        kCount
+    };
+
+    // Counter values of one measured region; events the kernel or CPU would
+    // not count are left empty
+    struct PerfSample {
+        std::array<std::optional<std::uint64_t>, static_cast<std::size_t>(PerfEvent::kCount)> values;
+
+        std::optional<std::uint64_t> get(PerfEvent event) const {
+            return values[static_cast<std::size_t>(event)];
+        }
+
+        bool any() const {
+            for (const auto& value : values) {
+                if (value) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::optional<double> ipc() const {
+            const auto cycles = get(PerfEvent::kCycles);
+            const auto instructions = get(PerfEvent::kInstructions);
+            if (!cycles || !instructions || *cycles == 0) {
+                return std::nullopt;
+            }
+            return static_cast<double>(*instructions) / static_cast<double>(*cycles);
+        }
+    };
+
+    // Hardware and software counters for the calling thread, read through
+    // Linux perf_event_open. Each event is opened on its own so one missing
+    // PMU event does not disable the rest; on other platforms, or when
+    // perf_event_paranoid forbids access, nothing is available and callers
+    // fall back to wall time.
+    class PerfCounters {
+        std::array<int, static_cast<std::size_t>(PerfEvent::kCount)> fds_;
+
+    public:
+        PerfCounters();
+        ~PerfCounters();
+
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        bool available() const;
+
+        void start();
+        PerfSample stop();
+    };
+
+    // One line such as "cycles 1.20M, instructions 3.41M, IPC 2.84, ..."
+    void print_perf_sample(std::ostream& os, const PerfSample& sample);
+}
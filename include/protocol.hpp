@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace aoc2025::protocol {
+    // Wire format of the --serve daemon. Every message is a frame: a 32-bit
+    // little-endian payload length followed by the payload.
+    //
+    //   request  payload: u32 id, u8 kind, u8 day, u8 part, input bytes
+    //   response payload: u32 id, u8 status, answer or error text
+    //
+    // Ids are chosen by the client and echoed back. Requests on one connection
+    // may be pipelined and are answered as they finish, not in order.
+    //
+    // A kSolveSlice request carries an encoded Slice instead of the input: a
+    // byte range of a file the server opens itself, so shards of a large file
+    // are not copied through the socket (see include/coordinator.hpp).
+
+    // Frames larger than this are rejected rather than buffered. Puzzle inputs
+    // are a few KiB and large files travel as slices, so this only bounds what
+    // one connection can make the server hold.
+    constexpr std::size_t kMaxFrameSize = std::size_t{64} << 20;
+
+    enum class Kind : std::uint8_t {
+        kSolve = 0,
+        kStats = 1,  // latency summary of all requests served so far
+        kSolveSlice = 2
+    };
+
+    enum class Status : std::uint8_t {
+        kOk = 0,
+        kError = 1
+    };
+
+    struct Request {
+        std::uint32_t id = 0;
+        Kind kind = Kind::kSolve;
+        std::uint8_t day = 0;
+        std::uint8_t part = 0;
+        std::string input;
+    };
+
+    struct Response {
+        std::uint32_t id = 0;
+        Status status = Status::kOk;
+        std::string text;
+    };
+
+    // Input of a kSolveSlice request: size bytes at offset into path, a path
+    // the server can open, e.g. on a shared filesystem
+    struct Slice {
+        std::uint64_t offset = 0;
+        std::uint64_t size = 0;
+        std::string path;
+    };
+
+    namespace detail {
+        inline void put_u32(std::string& out, std::uint32_t value) {
+            for (int shift = 0; shift < 32; shift += 8) {
+                out.push_back(static_cast<char>((value >> shift) & 0xFF));
+            }
+        }
+
+        inline std::uint32_t get_u32(std::string_view bytes) {
+            std::uint32_t value = 0;
+            for (int i = 3; i >= 0; --i) {
+                value = (value << 8) | static_cast<unsigned char>(bytes[static_cast<std::size_t>(i)]);
+            }
+            return value;
+        }
+
+        inline void put_u64(std::string& out, std::uint64_t value) {
+            put_u32(out, static_cast<std::uint32_t>(value));
+            put_u32(out, static_cast<std::uint32_t>(value >> 32));
+        }
+
+        inline std::uint64_t get_u64(std::string_view bytes) {
+            return get_u32(bytes) | (static_cast<std::uint64_t>(get_u32(bytes.substr(4))) << 32);
+        }
+
+        inline std::string frame(std::string payload) {
+            std::string out;
+            out.reserve(4 + payload.size());
+            put_u32(out, static_cast<std::uint32_t>(payload.size()));
+            out += payload;
+            return out;
+        }
+    }
+
+    inline std::string encode(const Request& request) {
+        std::string payload;
+        payload.reserve(7 + request.input.size());
+        detail::put_u32(payload, request.id);
+        payload.push_back(static_cast<char>(request.kind));
+        payload.push_back(static_cast<char>(request.day));
+        payload.push_back(static_cast<char>(request.part));
+        payload += request.input;
+        return detail::frame(std::move(payload));
+    }
+
+    inline std::string encode(const Response& response) {
+        std::string payload;
+        payload.reserve(5 + response.text.size());
+        detail::put_u32(payload, response.id);
+        payload.push_back(static_cast<char>(response.status));
+        payload += response.text;
+        return detail::frame(std::move(payload));
+    }
+
+    // Request input for a slice; not framed, it goes into Request::input
+    inline std::string encode(const Slice& slice) {
+        std::string out;
+        out.reserve(16 + slice.path.size());
+        detail::put_u64(out, slice.offset);
+        detail::put_u64(out, slice.size);
+        out += slice.path;
+        return out;
+    }
+
+    // Throws std::invalid_argument for a malformed payload
+    inline Request decode_request(std::string_view payload) {
+        if (payload.size() < 7) {
+            throw std::invalid_argument("Request payload too short");
+        }
+        Request request;
+        request.id = detail::get_u32(payload);
+        request.kind = static_cast<Kind>(payload[4]);
+        if (request.kind != Kind::kSolve && request.kind != Kind::kStats && request.kind != Kind::kSolveSlice) {
+            throw std::invalid_argument("Unknown request kind " + std::to_string(static_cast<int>(payload[4])));
+        }
+        request.day = static_cast<std::uint8_t>(payload[5]);
+        request.part = static_cast<std::uint8_t>(payload[6]);
+        request.input.assign(payload.substr(7));
+        return request;
+    }
+
+    inline Slice decode_slice(std::string_view input) {
+        if (input.size() < 16) {
+            throw std::invalid_argument("Slice too short");
+        }
+        return Slice{detail::get_u64(input), detail::get_u64(input.substr(8)), std::string(input.substr(16))};
+    }
+
+    inline Response decode_response(std::string_view payload) {
+        if (payload.size() < 5) {
+            throw std::invalid_argument("Response payload too short");
+        }
+        Response response;
+        response.id = detail::get_u32(payload);
+        response.status = static_cast<Status>(payload[4]);
+        response.text.assign(payload.substr(5));
+        return response;
+    }
+
+    // Reassembles frames from a byte stream that may split or merge them
+    // arbitrarily, e.g. successive read() calls on a socket
+    class FrameDecoder {
+        std::string buffer_;
+        std::size_t offset_ = 0;
+
+    public:
+        void feed(std::string_view bytes) {
+            buffer_.append(bytes);
+        }
+
+        // The next complete payload, if any; throws std::length_error for a
+        // frame over kMaxFrameSize
+        std::optional<std::string> next() {
+            const std::string_view pending = std::string_view(buffer_).substr(offset_);
+            if (pending.size() < 4) {
+                compact();
+                return std::nullopt;
+            }
+            const std::size_t size = detail::get_u32(pending);
+            if (size > kMaxFrameSize) {
+                throw std::length_error("Frame of " + std::to_string(size) + " bytes exceeds limit");
+            }
+            if (pending.size() < 4 + size) {
+                compact();
+                return std::nullopt;
+            }
+            std::string payload(pending.substr(4, size));
+            offset_ += 4 + size;
+            return payload;
+        }
+
+        // Bytes received but not yet returned as a payload
+        std::size_t buffered() const { return buffer_.size() - offset_; }
+
+    private:
+        void compact() {
+            buffer_.erase(0, offset_);
+            offset_ = 0;
+        }
+    };
+}
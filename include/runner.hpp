@@ -0,0 +1,52 @@
+#pragma once
+
+#include <filesystem>
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "aoc2025.hpp"
+#include "answer_cache.hpp"
+#include "thread_pool.hpp"
+
+namespace aoc2025 {
+    struct RunOptions {
+        // Days to run, empty means every registered day
+        std::vector<int> days;
+        unsigned threads = ThreadPool::default_thread_count();
+
+        // Print load, parse and per-part solve times
+        bool show_timings = false;
+
+        // Also read hardware counters around parse and solve (Linux only,
+        // degrades to timings when unavailable)
+        bool perf_counters = false;
+
+        // Report allocations per parse stage and part, plus peak RSS
+        bool alloc_stats = false;
+
+        // In builds with embedded inputs, answer from them instead of reading
+        // dayN/data.txt; parts solved during compilation cost nothing here
+        bool use_embedded = true;
+
+        CacheMode cache_mode = CacheMode::kUse;
+
+        // Load parsed models from dayN/data.txt.aocbin sidecars when they match
+        // the input, and write them after parsing (see model_cache.hpp)
+        bool model_cache = true;
+        std::filesystem::path cache_directory = ".aoc2025-cache";
+
+        // Solve one day from this file ("-" for stdin) in fixed-size chunks
+        // instead of loading data.txt whole; memory stays bounded by the chunk
+        // size. Needs a day with a streaming solver and bypasses the cache.
+        std::string stream_path;
+        std::size_t stream_chunk_size = std::size_t{1} << 20;
+    };
+
+    // Load and solve all selected days and parts concurrently, then print the
+    // results in day order exactly as a sequential run would. Returns 2 if any
+    // part failed, including for a missing or unreadable input, 1 on a usage
+    // error and 0 otherwise.
+    int run(const RunOptions& options, std::ostream& out, std::ostream& err);
+}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace aoc2025::scan {
+    // Index of the first byte equal to ch at or after from, or npos.
+    // char_traits::find is memchr at run time, which every mainstream libc
+    // vectorises, and a plain loop in constant expressions.
+    constexpr std::size_t find_byte(std::string_view text, char ch, std::size_t from = 0) {
+        if (from >= text.size()) {
+            return std::string_view::npos;
+        }
+        const char* found = std::char_traits<char>::find(text.data() + from, text.size() - from, ch);
+        return found == nullptr ? std::string_view::npos : static_cast<std::size_t>(found - text.data());
+    }
+
+    constexpr std::size_t count_byte(std::string_view text, char ch) {
+        std::size_t count = 0;
+        for (std::size_t at = find_byte(text, ch); at != std::string_view::npos; at = find_byte(text, ch, at + 1)) {
+            ++count;
+        }
+        return count;
+    }
+
+    constexpr bool is_space(char ch) {
+        return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n';
+    }
+
+    // text without leading and trailing spaces, tabs, CRs and newlines
+    constexpr std::string_view trim(std::string_view text) {
+        while (!text.empty() && is_space(text.front())) {
+            text.remove_prefix(1);
+        }
+        while (!text.empty() && is_space(text.back())) {
+            text.remove_suffix(1);
+        }
+        return text;
+    }
+
+    // Zero-copy range over the delimiter-separated fields of a string_view.
+    // A trailing delimiter does not produce an empty last field, so "a\nb\n"
+    // has two lines while "a\n\nb" has three.
+    class Fields {
+        std::string_view text_;
+        char delimiter_;
+
+    public:
+        class iterator {
+            const char* next_ = nullptr;
+            const char* end_ = nullptr;
+            std::string_view current_;
+            char delimiter_ = '\n';
+            bool at_end_ = true;
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = const std::string_view&;
+
+            iterator() = default;
+
+            constexpr iterator(std::string_view text, char delimiter)
+                : next_(text.data()), end_(text.data() + text.size()), delimiter_(delimiter), at_end_(false) {
+                advance();
+            }
+
+            constexpr reference operator*() const { return current_; }
+            constexpr pointer operator->() const { return &current_; }
+
+            constexpr iterator& operator++() {
+                advance();
+                return *this;
+            }
+
+            constexpr iterator operator++(int) {
+                iterator previous = *this;
+                advance();
+                return previous;
+            }
+
+            friend constexpr bool operator==(const iterator& lhs, const iterator& rhs) {
+                if (lhs.at_end_ || rhs.at_end_) {
+                    return lhs.at_end_ == rhs.at_end_;
+                }
+                return lhs.current_.data() == rhs.current_.data();
+            }
+
+        private:
+            constexpr void advance() {
+                if (next_ == end_) {
+                    at_end_ = true;
+                    current_ = {};
+                    return;
+                }
+                const std::size_t remaining = static_cast<std::size_t>(end_ - next_);
+                const char* found = std::char_traits<char>::find(next_, remaining, delimiter_);
+                const char* stop = found == nullptr ? end_ : found;
+                current_ = std::string_view(next_, static_cast<std::size_t>(stop - next_));
+                next_ = found == nullptr ? end_ : stop + 1;
+            }
+        };
+
+        constexpr Fields(std::string_view text, char delimiter) : text_(text), delimiter_(delimiter) {}
+
+        constexpr iterator begin() const { return iterator(text_, delimiter_); }
+        constexpr iterator end() const { return iterator(); }
+    };
+
+    constexpr Fields split(std::string_view text, char delimiter) {
+        return Fields(text, delimiter);
+    }
+
+    constexpr Fields lines(std::string_view text) {
+        return Fields(text, '\n');
+    }
+
+    namespace detail {
+        // Eight ASCII digits packed little-endian in one word
+        inline bool is_eight_digits(std::uint64_t chunk) {
+            return (((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+                     (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL);
+        }
+
+        // SWAR conversion of eight digits in three multiplies
+        inline std::uint32_t parse_eight_digits(std::uint64_t chunk) {
+            chunk -= 0x3030303030303030ULL;
+            chunk = (chunk * 10) + (chunk >> 8);
+            chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+                     (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+            return static_cast<std::uint32_t>(chunk);
+        }
+
+        // All-digit text to a value; nullopt for empty, non-digit or overflowing input
+        constexpr std::optional<std::uint64_t> parse_digits(std::string_view digits) {
+            if (digits.empty()) {
+                return std::nullopt;
+            }
+            std::uint64_t value = 0;
+            const char* p = digits.data();
+            const char* const end = p + digits.size();
+            // Nineteen digits always fit in 64 bits; longer numbers take the checked path
+            if (digits.size() > 19) {
+                for (; p < end; ++p) {
+                    const unsigned digit = static_cast<unsigned char>(*p) - '0';
+                    if (digit > 9 || value > (std::numeric_limits<std::uint64_t>::max() - digit) / 10) {
+                        return std::nullopt;
+                    }
+                    value = value * 10 + digit;
+                }
+                return value;
+            }
+            // SWAR needs memcpy, which constant expressions do not allow
+            if (std::endian::native == std::endian::little && !std::is_constant_evaluated()) {
+                for (; end - p >= 8; p += 8) {
+                    std::uint64_t chunk;
+                    std::memcpy(&chunk, p, sizeof(chunk));
+                    if (!is_eight_digits(chunk)) {
+                        return std::nullopt;
+                    }
+                    value = value * 100000000ULL + parse_eight_digits(chunk);
+                }
+            }
+            for (; p < end; ++p) {
+                const unsigned digit = static_cast<unsigned char>(*p) - '0';
+                if (digit > 9) {
+                    return std::nullopt;
+                }
+                value = value * 10 + digit;
+            }
+            return value;
+        }
+    }
+
+    // The whole of text as an integer of type T (optional leading '-' for
+    // signed types); nullopt if anything else is present or it does not fit
+    template <std::integral T>
+    constexpr std::optional<T> try_parse_int(std::string_view text) {
+        bool negative = false;
+        if constexpr (std::is_signed_v<T>) {
+            if (!text.empty() && text.front() == '-') {
+                negative = true;
+                text.remove_prefix(1);
+            }
+        }
+        const std::optional<std::uint64_t> magnitude = detail::parse_digits(text);
+        if (!magnitude) {
+            return std::nullopt;
+        }
+        using Unsigned = std::make_unsigned_t<T>;
+        const auto max = static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+        if (negative) {
+            if (*magnitude > max + 1) {
+                return std::nullopt;
+            }
+            return static_cast<T>(static_cast<Unsigned>(0) - static_cast<Unsigned>(*magnitude));
+        }
+        if (*magnitude > max) {
+            return std::nullopt;
+        }
+        return static_cast<T>(*magnitude);
+    }
+
+    // As try_parse_int, but throws std::invalid_argument naming what was expected
+    template <std::integral T>
+    T parse_int(std::string_view text, std::string_view what = "integer") {
+        if (const std::optional<T> value = try_parse_int<T>(text)) {
+            return *value;
+        }
+        throw std::invalid_argument("Invalid " + std::string(what) + ": '" + std::string(text) + "'");
+    }
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "answer.hpp"
+#include "protocol.hpp"
+#include "thread_pool.hpp"
+
+namespace aoc2025 {
+    // Latencies of served requests; percentiles cover the most recent kWindow
+    class LatencyStats {
+    public:
+        static constexpr std::size_t kWindow = 8192;
+
+        struct Summary {
+            std::uint64_t count = 0;
+            std::uint64_t errors = 0;
+            std::uint64_t p50_ns = 0;
+            std::uint64_t p99_ns = 0;
+            std::uint64_t max_ns = 0;
+        };
+
+        void record(std::uint64_t ns, bool ok);
+        Summary summary() const;
+
+        // e.g. "requests=12 errors=0 p50_us=4.1 p99_us=20.3 max_us=31.0"
+        static std::string format(const Summary& summary);
+
+    private:
+        mutable std::mutex mutex_;
+        std::vector<std::uint64_t> window_;
+        std::size_t next_ = 0;
+        std::uint64_t count_ = 0;
+        std::uint64_t errors_ = 0;
+        std::uint64_t max_ns_ = 0;
+    };
+
+    // Files a kSolveSlice request may name. Anyone who can reach a daemon's
+    // socket can send one, so a daemon serves slices only of files under the
+    // directories it was given; a worker forked by the Coordinator talks to
+    // nothing but the coordinator, which picked the file itself.
+    struct SliceAccess {
+        bool any_file = false;
+        std::vector<std::filesystem::path> roots;
+
+        // Whether path resolves, symlinks and all, to a file under a root
+        bool allows(const std::filesystem::path& path) const;
+    };
+
+    struct ServeOptions {
+        std::string socket_path;
+        unsigned threads = ThreadPool::default_thread_count();
+        // Directories whose files kSolveSlice requests may read; none refuses
+        // every slice request
+        std::vector<std::filesystem::path> slice_roots = {};
+        // Connections served at once, each of which may buffer up to
+        // protocol::kMaxFrameSize; more are answered with an error and closed
+        std::size_t max_connections = 64;
+    };
+
+    // Answers protocol requests on a Unix domain socket. Each connection has a
+    // reader thread that decodes frames and hands requests to a shared worker
+    // pool, so pipelined requests are solved concurrently and answered as they
+    // finish. The day registry stays loaded between requests.
+    class Server {
+        struct Connection;
+
+        ServeOptions options_;
+        SliceAccess slice_access_;
+        int listen_fd_ = -1;
+        int wake_fds_[2] = {-1, -1};
+        // Inode of the bound socket file, so the destructor removes only that
+        std::uint64_t socket_inode_ = 0;
+        LatencyStats stats_;
+        std::mutex connections_mutex_;
+        std::list<std::shared_ptr<Connection>> connections_;
+        // Declared last so queued work drains before the rest is torn down
+        std::unique_ptr<ThreadPool> pool_;
+
+    public:
+        // Binds and listens, replacing a stale socket file. Throws
+        // std::runtime_error if the path is not a socket or a daemon answers on it.
+        explicit Server(ServeOptions options);
+        ~Server();
+
+        Server(const Server&) = delete;
+        Server& operator=(const Server&) = delete;
+
+        // Accept connections until stop() is called
+        void run();
+
+        // Thread-safe and async-signal-safe
+        void stop();
+
+        const LatencyStats& stats() const { return stats_; }
+
+    private:
+        void serve_connection(const std::shared_ptr<Connection>& connection);
+        void handle(const std::shared_ptr<Connection>& connection, protocol::Request request,
+                    std::uint64_t received_ns);
+        void reap_connections(bool all);
+    };
+
+    // Blocking client for the daemon, used by tests and tools
+    class Client {
+        int fd_ = -1;
+        protocol::FrameDecoder decoder_;
+
+    public:
+        explicit Client(const std::string& socket_path);
+        ~Client();
+
+        Client(const Client&) = delete;
+        Client& operator=(const Client&) = delete;
+
+        void send(const protocol::Request& request);
+
+        // Next response in completion order; throws std::runtime_error on disconnect
+        protocol::Response receive();
+
+        // Send one request and wait for its answer; throws std::runtime_error
+        // with the server's message on an error response
+        Answer solve(int day, int part, std::string_view input);
+
+        std::string stats();
+    };
+
+    // Socket helpers shared with the coordinator: write_all sends everything
+    // or returns false and never raises SIGPIPE; connect_socket returns a
+    // connected close-on-exec descriptor or throws std::runtime_error
+    bool write_all(int fd, std::string_view bytes);
+    int connect_socket(const std::string& path);
+
+    // Solve one kSolve or kSolveSlice request against the day registry; errors,
+    // including unknown days and parts, slices of files outside access and
+    // slices of compressed files, become kError responses
+    protocol::Response solve_request(const protocol::Request& request, const SliceAccess& access);
+
+    // Answer requests on an already connected socket one at a time until the
+    // peer hangs up; the loop of the worker processes forked by Coordinator,
+    // which may slice any file
+    void serve_socket(int fd);
+
+    // Run a server until SIGINT or SIGTERM, reporting errors to err
+    int serve(const ServeOptions& options, std::ostream& err);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace aoc2025 {
+    // Parse a size such as "4096", "64K", "16M" or "1G"; returns 0 on malformed
+    // input or a size that does not fit in std::size_t
+    inline std::size_t parse_size(const std::string& text) {
+        // stoull would accept leading blanks and wrap a minus sign around
+        if (text.empty() || text[0] < '0' || text[0] > '9') {
+            return 0;
+        }
+        std::size_t pos = 0;
+        unsigned long long value = 0;
+        try {
+            value = std::stoull(text, &pos);
+        } catch (const std::exception&) {
+            return 0;
+        }
+        int shift = 0;
+        if (pos + 1 == text.size()) {
+            switch (text[pos]) {
+                case 'K': case 'k': shift = 10; break;
+                case 'M': case 'm': shift = 20; break;
+                case 'G': case 'g': shift = 30; break;
+                default: return 0;
+            }
+        } else if (pos != text.size()) {
+            return 0;
+        }
+        if (value > (std::numeric_limits<std::size_t>::max() >> shift)) {
+            return 0;
+        }
+        return static_cast<std::size_t>(value) << shift;
+    }
+
+    // Human readable size using the same suffixes as parse_size
+    inline std::string format_size(std::size_t bytes) {
+        if (bytes >= (std::size_t{1} << 30) && bytes % (std::size_t{1} << 30) == 0) {
+            return std::to_string(bytes >> 30) + "G";
+        }
+        if (bytes >= (std::size_t{1} << 20) && bytes % (std::size_t{1} << 20) == 0) {
+            return std::to_string(bytes >> 20) + "M";
+        }
+        if (bytes >= (std::size_t{1} << 10) && bytes % (std::size_t{1} << 10) == 0) {
+            return std::to_string(bytes >> 10) + "K";
+        }
+        return std::to_string(bytes);
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "answer.hpp"
+#include "scan.hpp"
+
+namespace aoc2025 {
+    // Solver for one part that consumes its input incrementally: feed() the
+    // chunks in order, then finish(). Chunks may split records anywhere.
+    class StreamSolver {
+    public:
+        virtual ~StreamSolver() = default;
+        virtual void feed(std::string_view chunk) = 0;
+        virtual Answer finish() = 0;
+    };
+
+    // Splits a chunked byte stream into delimiter-separated records, carrying a
+    // partial record over to the next chunk. Memory is bounded by the longest
+    // record, not by the input.
+    class RecordSplitter {
+        char delimiter_;
+        std::string carry_;
+
+    public:
+        explicit RecordSplitter(char delimiter) : delimiter_(delimiter) {}
+
+        // Call fn with every record completed by chunk
+        template <typename Fn>
+        void feed(std::string_view chunk, Fn&& fn) {
+            while (!chunk.empty()) {
+                const std::size_t end = scan::find_byte(chunk, delimiter_);
+                if (end == std::string_view::npos) {
+                    carry_.append(chunk);
+                    return;
+                }
+                if (carry_.empty()) {
+                    fn(chunk.substr(0, end));
+                } else {
+                    carry_.append(chunk.substr(0, end));
+                    fn(std::string_view(carry_));
+                    carry_.clear();
+                }
+                chunk.remove_prefix(end + 1);
+            }
+        }
+
+        // Call fn with the final record if the input did not end with a delimiter
+        template <typename Fn>
+        void finish(Fn&& fn) {
+            if (!carry_.empty()) {
+                fn(std::string_view(carry_));
+                carry_.clear();
+            }
+        }
+    };
+
+    // Feed input to solver in chunk_size pieces and return its answer
+    inline Answer stream_solve(StreamSolver& solver, std::string_view input, std::size_t chunk_size) {
+        if (chunk_size == 0) {
+            chunk_size = input.size() + 1;
+        }
+        while (!input.empty()) {
+            const std::size_t take = std::min(chunk_size, input.size());
+            solver.feed(input.substr(0, take));
+            input.remove_prefix(take);
+        }
+        return solver.finish();
+    }
+}
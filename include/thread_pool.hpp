@@ -0,0 +1,90 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "trace.hpp"
+
+namespace aoc2025 {
+    // Fixed-size pool of worker threads draining a FIFO queue of tasks.
+    // Tasks may submit further tasks; the destructor finishes all queued work.
+    class ThreadPool {
+        std::vector<std::thread> workers_;
+        std::queue<std::function<void()>> tasks_;
+        std::mutex mutex_;
+        std::condition_variable ready_;
+        bool stopping_ = false;
+
+    public:
+        explicit ThreadPool(unsigned thread_count = default_thread_count()) {
+            if (thread_count == 0) {
+                thread_count = 1;
+            }
+            workers_.reserve(thread_count);
+            for (unsigned i = 0; i < thread_count; ++i) {
+                workers_.emplace_back([this]() { work(); });
+            }
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard lock(mutex_);
+                stopping_ = true;
+            }
+            ready_.notify_all();
+            for (auto& worker : workers_) {
+                worker.join();
+            }
+        }
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        static unsigned default_thread_count() {
+            const unsigned count = std::thread::hardware_concurrency();
+            return count == 0 ? 1 : count;
+        }
+
+        std::size_t size() const { return workers_.size(); }
+
+        // Queue fn and return a future for its result (or exception)
+        template <typename Fn>
+        auto submit(Fn&& fn) -> std::future<std::invoke_result_t<std::decay_t<Fn>>> {
+            using Result = std::invoke_result_t<std::decay_t<Fn>>;
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+            std::future<Result> result = task->get_future();
+            {
+                std::lock_guard lock(mutex_);
+                tasks_.emplace([task]() { (*task)(); });
+            }
+            ready_.notify_one();
+            return result;
+        }
+
+    private:
+        void work() {
+            AOC2025_TRACE_THREAD("worker");
+            for (;;) {
+                std::function<void()> task;
+                {
+                    std::unique_lock lock(mutex_);
+                    ready_.wait(lock, [this]() { return stopping_ || !tasks_.empty(); });
+                    if (tasks_.empty()) {
+                        return;
+                    }
+                    task = std::move(tasks_.front());
+                    tasks_.pop();
+                }
+                task();
+            }
+        }
+    };
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Tracing is compiled in only with -DAOC2025_TRACING=1 (CMake option
+// AOC2025_ENABLE_TRACING). Otherwise the macros below expand to nothing.
+#ifndef AOC2025_TRACING
+#define AOC2025_TRACING 0
+#endif
+
+namespace aoc2025::trace {
+    // Tracing must also be switched on at runtime (e.g. with --trace); a
+    // disabled zone costs one relaxed atomic load
+    void set_enabled(bool enabled);
+    bool enabled();
+
+    std::uint64_t now_ns();
+
+    // Record a finished zone; arg is attached as args.value when non-negative
+    void complete(const char* name, std::uint64_t start_ns, std::uint64_t end_ns, std::int64_t arg);
+    void counter(const char* name, std::int64_t value);
+    void thread_name(const char* name);
+
+    // Write every event recorded so far in Chrome trace event format, loadable
+    // in chrome://tracing and ui.perfetto.dev
+    bool write_chrome_json(const std::string& path);
+
+    // Drop all recorded events
+    void clear();
+
+    class Zone {
+        const char* name_;
+        std::int64_t arg_;
+        std::uint64_t start_ns_;
+
+    public:
+        explicit Zone(const char* name, std::int64_t arg = -1)
+            : name_(name), arg_(arg), start_ns_(enabled() ? now_ns() : 0) {}
+
+        ~Zone() {
+            if (start_ns_ != 0) {
+                complete(name_, start_ns_, now_ns(), arg_);
+            }
+        }
+
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+    };
+}
+
+#define AOC2025_TRACE_CONCAT_INNER(a, b) a##b
+#define AOC2025_TRACE_CONCAT(a, b) AOC2025_TRACE_CONCAT_INNER(a, b)
+
+#if AOC2025_TRACING
+#define AOC2025_TRACE_ZONE(...) \
+    const ::aoc2025::trace::Zone AOC2025_TRACE_CONCAT(aoc2025_trace_zone_, __LINE__)(__VA_ARGS__)
+#define AOC2025_TRACE_COUNTER(name, value) \
+    do { if (::aoc2025::trace::enabled()) ::aoc2025::trace::counter(name, static_cast<std::int64_t>(value)); } while (0)
+#define AOC2025_TRACE_THREAD(name) \
+    do { if (::aoc2025::trace::enabled()) ::aoc2025::trace::thread_name(name); } while (0)
+#else
+#define AOC2025_TRACE_ZONE(...) static_cast<void>(0)
+#define AOC2025_TRACE_COUNTER(name, value) static_cast<void>(0)
+#define AOC2025_TRACE_THREAD(name) static_cast<void>(0)
+#endif
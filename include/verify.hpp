@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "generator.hpp"
+
+namespace aoc2025::verify {
+    // Shrink a failing case while still_fails holds: first drop ever smaller
+    // chunks of elements (delta debugging), then let shrink_element propose
+    // smaller replacements for single elements. The result is 1-minimal with
+    // respect to both kinds of step.
+    template <typename T, typename StillFails, typename ShrinkElement>
+    std::vector<T> minimize(std::vector<T> failing, StillFails still_fails, ShrinkElement shrink_element) {
+        for (bool progress = true; progress;) {
+            progress = false;
+            for (std::size_t chunk = failing.size() / 2; chunk >= 1; chunk /= 2) {
+                for (std::size_t begin = 0; begin + chunk <= failing.size();) {
+                    std::vector<T> candidate(failing.begin(), failing.begin() + static_cast<std::ptrdiff_t>(begin));
+                    candidate.insert(candidate.end(), failing.begin() + static_cast<std::ptrdiff_t>(begin + chunk), failing.end());
+                    if (!candidate.empty() && still_fails(candidate)) {
+                        failing = std::move(candidate);
+                        progress = true;
+                    } else {
+                        begin += chunk;
+                    }
+                }
+            }
+            for (std::size_t i = 0; i < failing.size(); ++i) {
+                for (const T& smaller : shrink_element(failing[i])) {
+                    std::vector<T> candidate = failing;
+                    candidate[i] = smaller;
+                    if (still_fails(candidate)) {
+                        failing = std::move(candidate);
+                        progress = true;
+                        break;
+                    }
+                }
+            }
+        }
+        return failing;
+    }
+
+    template <typename T, typename StillFails>
+    std::vector<T> minimize(std::vector<T> failing, StillFails still_fails) {
+        return minimize(std::move(failing), still_fails, [](const T&) { return std::vector<T>{}; });
+    }
+
+    template <typename T>
+    struct Mismatch {
+        std::vector<T> input;  // minimized
+        std::string fast;
+        std::string oracle;
+        std::uint64_t seed;    // generator seed that first produced it
+    };
+
+    // Cases per differential check; AOC2025_VERIFY_ITERATIONS raises it for
+    // soak runs without rebuilding
+    inline int iterations(int fallback) {
+        if (const char* value = std::getenv("AOC2025_VERIFY_ITERATIONS")) {
+            const int parsed = std::atoi(value);
+            if (parsed > 0) {
+                return parsed;
+            }
+        }
+        return fallback;
+    }
+
+    // Compare fast and oracle on the given fixed cases, then on cases drawn
+    // from generate(random) for seeds seed..seed+count-1. Both are called
+    // with a std::vector<T> and must return something printable. Returns the
+    // first disagreement, minimized.
+    template <typename T, typename Generate, typename Fast, typename Oracle, typename ShrinkElement>
+    std::optional<Mismatch<T>> find_mismatch(const std::vector<std::vector<T>>& fixed, std::uint64_t seed, int count,
+                                             Generate generate, Fast fast, Oracle oracle, ShrinkElement shrink_element) {
+        auto render = [](const auto& value) {
+            std::ostringstream out;
+            out << value;
+            return out.str();
+        };
+        auto differs = [&](const std::vector<T>& input) {
+            return render(fast(input)) != render(oracle(input));
+        };
+        auto report = [&](const std::vector<T>& failing, std::uint64_t failing_seed) {
+            std::vector<T> minimal = minimize(failing, differs, shrink_element);
+            return Mismatch<T>{minimal, render(fast(minimal)), render(oracle(minimal)), failing_seed};
+        };
+
+        for (const auto& input : fixed) {
+            if (differs(input)) {
+                return report(input, 0);
+            }
+        }
+        for (int i = 0; i < count; ++i) {
+            gen::Random random(seed + static_cast<std::uint64_t>(i));
+            const std::vector<T> input = generate(random);
+            if (differs(input)) {
+                return report(input, seed + static_cast<std::uint64_t>(i));
+            }
+        }
+        return std::nullopt;
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "aoc2025.hpp"
+
+namespace aoc2025 {
+    struct WatchOptions {
+        // Days to watch, empty means every registered day with an input and
+        // an incremental solver
+        std::vector<int> days;
+        std::chrono::milliseconds interval{200};
+        bool show_timings = false;
+    };
+
+    // Keeps an incremental solver per input file and re-solves a file when
+    // its size or modification time changes
+    class Watcher {
+    public:
+        struct Target {
+            const Day* day;
+            std::filesystem::path path;
+        };
+
+        struct Update {
+            int day_number = 0;
+            // Parts the day has; a part without an answer failed
+            std::array<bool, 2> unlocked = {false, false};
+            std::array<std::optional<Answer>, 2> answers;
+            std::size_t records = 0;
+            double read_ms = 0.0;
+            double solve_ms = 0.0;
+            // Set when the file could not be read or parsed; the answers are
+            // then left empty
+            std::string error;
+        };
+
+        explicit Watcher(std::vector<Target> targets);
+
+        // Check every file once; an update for each that changed since the
+        // last poll, all of them on the first
+        std::vector<Update> poll();
+
+    private:
+        struct Watched {
+            Target target;
+            std::unique_ptr<IncrementalSolver> solver;
+            std::optional<std::pair<std::uintmax_t, std::filesystem::file_time_type>> seen;
+        };
+
+        std::vector<Watched> watched_;
+    };
+
+    void print_update(std::ostream& out, std::ostream& err, const Watcher::Update& update, bool show_timings);
+
+    // Print answers, then updated ones whenever an input changes, until
+    // SIGINT or SIGTERM
+    int watch(const WatchOptions& options, std::ostream& out, std::ostream& err);
+}
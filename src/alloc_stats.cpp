@@ -0,0 +1,159 @@
+#include "alloc_stats.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace aoc2025::alloc {
+    namespace {
+        struct Counters {
+            std::uint64_t count;
+            std::uint64_t bytes;
+            std::int64_t live;
+            std::int64_t peak_live;
+        };
+
+        constinit thread_local Counters t_counters{};
+    }
+
+#ifdef AOC2025_ALLOC_STATS
+    namespace {
+        // Every block carries its size in a header so frees can be accounted
+        // without relying on sized deallocation
+        constexpr std::size_t kHeader = alignof(std::max_align_t);
+
+        void on_allocate(std::size_t size) {
+            Counters& counters = t_counters;
+            ++counters.count;
+            counters.bytes += size;
+            counters.live += static_cast<std::int64_t>(size);
+            counters.peak_live = std::max(counters.peak_live, counters.live);
+        }
+
+        void on_free(std::size_t size) {
+            t_counters.live -= static_cast<std::int64_t>(size);
+        }
+
+        void* allocate(std::size_t size, std::size_t alignment) {
+            const std::size_t header = std::max(kHeader, alignment);
+            void* base = alignment <= kHeader ? std::malloc(size + header)
+                                              : std::aligned_alloc(alignment, (size + header + alignment - 1) / alignment * alignment);
+            if (base == nullptr) {
+                throw std::bad_alloc();
+            }
+            char* user = static_cast<char*>(base) + header;
+            *reinterpret_cast<std::size_t*>(user - sizeof(std::size_t)) = size;
+            on_allocate(size);
+            return user;
+        }
+
+        void release(void* pointer, std::size_t alignment) {
+            if (pointer == nullptr) {
+                return;
+            }
+            char* user = static_cast<char*>(pointer);
+            on_free(*reinterpret_cast<std::size_t*>(user - sizeof(std::size_t)));
+            std::free(user - std::max(kHeader, alignment));
+        }
+    }
+
+    bool tracking_compiled() {
+        return true;
+    }
+#else
+    bool tracking_compiled() {
+        return false;
+    }
+#endif
+
+    Scope::Scope()
+        : start_count_(t_counters.count), start_bytes_(t_counters.bytes), start_live_(t_counters.live),
+          saved_peak_(t_counters.peak_live) {
+        t_counters.peak_live = t_counters.live;
+    }
+
+    Scope::~Scope() {
+        t_counters.peak_live = std::max(t_counters.peak_live, saved_peak_);
+    }
+
+    Stats Scope::stop() const {
+        const Counters& counters = t_counters;
+        return Stats{counters.count - start_count_, counters.bytes - start_bytes_,
+                     static_cast<std::uint64_t>(std::max<std::int64_t>(counters.peak_live - start_live_, 0))};
+    }
+
+    std::uint64_t peak_rss_bytes() {
+#if defined(__unix__) || defined(__APPLE__)
+        rusage usage{};
+        if (::getrusage(RUSAGE_SELF, &usage) != 0) {
+            return 0;
+        }
+#ifdef __APPLE__
+        return static_cast<std::uint64_t>(usage.ru_maxrss);
+#else
+        return static_cast<std::uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+        return 0;
+#endif
+    }
+
+    void print_bytes(std::ostream& os, std::uint64_t bytes) {
+        const auto flags = os.flags();
+        const auto precision = os.precision();
+        os << std::fixed << std::setprecision(1);
+        const double value = static_cast<double>(bytes);
+        if (bytes >= (std::uint64_t{1} << 30)) {
+            os << value / (1 << 30) << " GB";
+        } else if (bytes >= (std::uint64_t{1} << 20)) {
+            os << value / (1 << 20) << " MB";
+        } else if (bytes >= (std::uint64_t{1} << 10)) {
+            os << value / (1 << 10) << " KB";
+        } else {
+            os << bytes << " B";
+        }
+        os.flags(flags);
+        os.precision(precision);
+    }
+
+    void print_stats(std::ostream& os, const Stats& stats) {
+        os << stats.count << " allocations, ";
+        print_bytes(os, stats.bytes);
+        os << ", peak live ";
+        print_bytes(os, stats.peak_live);
+    }
+}
+
+#ifdef AOC2025_ALLOC_STATS
+// Replacements for the global allocation functions. The nothrow and array
+// forms are specified to forward to these.
+void* operator new(std::size_t size) {
+    return aoc2025::alloc::allocate(size, 0);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return aoc2025::alloc::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer) noexcept {
+    aoc2025::alloc::release(pointer, 0);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    aoc2025::alloc::release(pointer, 0);
+}
+
+void operator delete(void* pointer, std::align_val_t alignment) noexcept {
+    aoc2025::alloc::release(pointer, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept {
+    aoc2025::alloc::release(pointer, static_cast<std::size_t>(alignment));
+}
+#endif
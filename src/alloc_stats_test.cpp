@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "alloc_stats.hpp"
+
+namespace alloc_stats_tests {
+
+TEST_CASE("AllocStats: Scope - Counts Thread Allocations", "[alloc][component]") {
+    // Arrange
+    const aoc2025::alloc::Scope scope;
+    
+    // Act
+    {
+        std::vector<std::unique_ptr<int>> values;
+        values.reserve(10);
+        for (int i = 0; i < 10; ++i) {
+            values.push_back(std::make_unique<int>(i));
+        }
+    }
+    const aoc2025::alloc::Stats stats = scope.stop();
+    
+    // Assert
+    if (aoc2025::alloc::tracking_compiled()) {
+        REQUIRE(stats.count == 11);
+        REQUIRE(stats.bytes == 10 * sizeof(int) + 10 * sizeof(std::unique_ptr<int>));
+        REQUIRE(stats.peak_live == stats.bytes);
+    } else {
+        REQUIRE(stats.count == 0);
+    }
+}
+
+TEST_CASE("AllocStats: Scope - Peak Live Below Total", "[alloc][component]") {
+    // Arrange
+    const aoc2025::alloc::Scope scope;
+    
+    // Act
+    for (int i = 0; i < 4; ++i) {
+        auto block = std::make_unique<char[]>(1000);
+        block[0] = 'x';
+    }
+    const aoc2025::alloc::Stats stats = scope.stop();
+    
+    // Assert
+    if (aoc2025::alloc::tracking_compiled()) {
+        REQUIRE(stats.bytes == 4000);
+        REQUIRE(stats.peak_live == 1000);
+    }
+}
+
+TEST_CASE("AllocStats: Scope - Nested Scopes Keep The Outer Peak", "[alloc][component]") {
+    // Arrange
+    const aoc2025::alloc::Scope outer;
+    aoc2025::alloc::Stats inner_stats;
+
+    // Act: the outer peak comes before the inner scope starts
+    {
+        auto block = std::make_unique<char[]>(3000);
+        block[0] = 'x';
+    }
+    {
+        const aoc2025::alloc::Scope inner;
+        auto block = std::make_unique<char[]>(1000);
+        block[0] = 'x';
+        inner_stats = inner.stop();
+    }
+    const aoc2025::alloc::Stats outer_stats = outer.stop();
+
+    // Assert
+    if (aoc2025::alloc::tracking_compiled()) {
+        REQUIRE(inner_stats.peak_live == 1000);
+        REQUIRE(outer_stats.bytes == 4000);
+        REQUIRE(outer_stats.peak_live == 3000);
+    }
+}
+
+TEST_CASE("AllocStats: Print - Human Readable", "[alloc][component]") {
+    // Arrange
+    std::ostringstream oss;
+    
+    // Act
+    aoc2025::alloc::print_stats(oss, aoc2025::alloc::Stats{3, 3 * 1024, 2048});
+    
+    // Assert
+    REQUIRE(oss.str() == "3 allocations, 3.0 KB, peak live 2.0 KB");
+}
+
+TEST_CASE("AllocStats: Peak RSS - Reported", "[alloc][component]") {
+#if defined(__unix__) || defined(__APPLE__)
+    REQUIRE(aoc2025::alloc::peak_rss_bytes() > 0);
+#endif
+}
+
+} // namespace alloc_stats_tests
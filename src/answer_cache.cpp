@@ -0,0 +1,79 @@
+#include "answer_cache.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <system_error>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace aoc2025 {
+    namespace {
+        std::string temporary_suffix() {
+            static std::atomic<unsigned> counter = 0;
+            std::ostringstream suffix;
+#if defined(__unix__) || defined(__APPLE__)
+            suffix << ".tmp." << ::getpid();
+#else
+            suffix << ".tmp";
+#endif
+            suffix << '.' << std::this_thread::get_id() << '.' << counter++;
+            return suffix.str();
+        }
+    }
+
+    std::string CacheKey::file_name() const {
+        char hash[17];
+        std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(input_hash));
+        return "day" + std::to_string(day_number) + "-part" + std::to_string(part) +
+               "-v" + solver_version + "-" + hash + "-" + std::to_string(input_size);
+    }
+
+    std::optional<std::string> AnswerCache::load(const CacheKey& key) const {
+        std::ifstream file(directory_ / key.file_name(), std::ios::binary);
+        if (!file.is_open()) {
+            return std::nullopt;
+        }
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        std::string answer = std::move(contents).str();
+        if (answer.empty()) {
+            return std::nullopt;
+        }
+        return answer;
+    }
+
+    bool AnswerCache::store(const CacheKey& key, std::string_view answer) const {
+        std::error_code error;
+        std::filesystem::create_directories(directory_, error);
+        if (error) {
+            return false;
+        }
+
+        const std::filesystem::path target = directory_ / key.file_name();
+        const std::filesystem::path temporary = directory_ / (key.file_name() + temporary_suffix());
+        {
+            std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                return false;
+            }
+            file.write(answer.data(), static_cast<std::streamsize>(answer.size()));
+            if (!file.good()) {
+                file.close();
+                std::filesystem::remove(temporary, error);
+                return false;
+            }
+        }
+        // rename() atomically replaces an existing entry
+        std::filesystem::rename(temporary, target, error);
+        if (error) {
+            std::filesystem::remove(temporary, error);
+            return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,67 @@
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <string>
+#include "answer_cache.hpp"
+#include "hash.hpp"
+
+namespace answer_cache_tests {
+
+static std::filesystem::path fresh_directory(const std::string& name) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(path);
+    return path;
+}
+
+TEST_CASE("Hash: hash_bytes - Known XXH64 Values", "[cache][hash]") {
+    // Assert
+    REQUIRE(aoc2025::hash_bytes("") == 0xEF46DB3751D8E999ULL);
+    REQUIRE(aoc2025::hash_bytes("a") == 0xD24EC4F1A98C6E5BULL);
+    REQUIRE(aoc2025::hash_bytes("abc") == 0x44BC2CF5AD770999ULL);
+    REQUIRE(aoc2025::hash_bytes("The quick brown fox jumps over the lazy dog") == 0x0B242D361FDA71BCULL);
+}
+
+TEST_CASE("AnswerCache: Store - Round Trip", "[cache][component]") {
+    // Arrange
+    const aoc2025::AnswerCache cache(fresh_directory("aoc2025_cache_roundtrip"));
+    const aoc2025::CacheKey key{3, 2, "1", aoc2025::hash_bytes("987654321111111"), 15};
+    
+    // Act
+    const bool stored = cache.store(key, "987654321111");
+    
+    // Assert
+    REQUIRE(stored);
+    REQUIRE(cache.load(key) == std::optional<std::string>("987654321111"));
+    std::filesystem::remove_all(cache.directory());
+}
+
+TEST_CASE("AnswerCache: Load - Miss On Different Version", "[cache][component]") {
+    // Arrange
+    const aoc2025::AnswerCache cache(fresh_directory("aoc2025_cache_version"));
+    const aoc2025::CacheKey key{1, 1, "1", 42, 10};
+    aoc2025::CacheKey bumped = key;
+    bumped.solver_version = "2";
+    
+    // Act
+    cache.store(key, "3");
+    
+    // Assert
+    REQUIRE(cache.load(key).has_value());
+    REQUIRE_FALSE(cache.load(bumped).has_value());
+    std::filesystem::remove_all(cache.directory());
+}
+
+TEST_CASE("AnswerCache: Store - Replaces Existing Entry", "[cache][component]") {
+    // Arrange
+    const aoc2025::AnswerCache cache(fresh_directory("aoc2025_cache_replace"));
+    const aoc2025::CacheKey key{2, 1, "1", 7, 100};
+    
+    // Act
+    cache.store(key, "1227775554");
+    cache.store(key, "4174379265");
+    
+    // Assert
+    REQUIRE(cache.load(key) == std::optional<std::string>("4174379265"));
+    std::filesystem::remove_all(cache.directory());
+}
+
+} // namespace answer_cache_tests
@@ -0,0 +1,73 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <sstream>
+#include "aoc2025.hpp"
+#include "answer.hpp"
+#include "day1.hpp"
+
+namespace answer_tests {
+
+TEST_CASE("Answer: Construct - Integers Compare By Value", "[answer][component]") {
+    // Assert
+    REQUIRE(aoc2025::Answer(3) == aoc2025::Answer(std::int64_t{3}));
+    REQUIRE(aoc2025::Answer(std::uint64_t{3}) == aoc2025::Answer(3));
+    REQUIRE_FALSE(aoc2025::Answer(3) == aoc2025::Answer("3"));
+}
+
+TEST_CASE("Answer: to_string - Integer And Text", "[answer][component]") {
+    // Assert
+    REQUIRE(aoc2025::Answer(1227775554).to_string() == "1227775554");
+    REQUIRE(aoc2025::Answer(-42).to_string() == "-42");
+    REQUIRE(aoc2025::Answer("abc").to_string() == "abc");
+}
+
+TEST_CASE("Answer: Parse - Round Trip", "[answer][component]") {
+    // Assert
+    REQUIRE(aoc2025::Answer::parse("4174379265") == aoc2025::Answer(4174379265));
+    REQUIRE(aoc2025::Answer::parse("-7") == aoc2025::Answer(-7));
+    REQUIRE(aoc2025::Answer::parse("not a number") == aoc2025::Answer("not a number"));
+    REQUIRE(aoc2025::Answer::parse("").to_string().empty());
+}
+
+TEST_CASE("Answer: Add - Sums Integers", "[answer][component]") {
+    // Arrange
+    aoc2025::Answer total = 0;
+    
+    // Act
+    total += 357;
+    total += aoc2025::Answer(3121910778619);
+    
+    // Assert
+    REQUIRE(total == aoc2025::Answer(3121910778976));
+    REQUIRE_THROWS_AS(total + aoc2025::Answer("x"), std::invalid_argument);
+}
+
+#ifdef AOC2025_HAVE_INT128
+TEST_CASE("Answer: Add - Widens Past 64 Bits", "[answer][component]") {
+    // Arrange
+    const aoc2025::Answer max = INT64_MAX;
+    
+    // Act
+    const aoc2025::Answer sum = max + max;
+    
+    // Assert
+    REQUIRE(sum.to_string() == "18446744073709551614");
+    REQUIRE(aoc2025::Answer::parse("18446744073709551614") == sum);
+    REQUIRE_THROWS_AS(sum.as_int64(), std::out_of_range);
+}
+#endif
+
+TEST_CASE("Answer: Day - Typed Solver Matches Stream Adaptor", "[answer][integration]") {
+    // Arrange
+    const std::string input = "L68\nL30\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82";
+    std::ostringstream oss;
+    
+    // Act
+    Day1::Day1.part1(oss, input);
+    
+    // Assert
+    REQUIRE(Day1::Day1.solve(1, input) == aoc2025::Answer(3));
+    REQUIRE(Day1::Day1.solve(1, input).to_string() == oss.str());
+}
+
+} // namespace answer_tests
@@ -0,0 +1,318 @@
+#include "batch.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+#include "aoc2025.hpp"
+#include "compression.hpp"
+#include "model_cache.hpp"
+#include "trace.hpp"
+
+namespace aoc2025 {
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        // Counting budget of input bytes; reserve blocks until the request fits
+        class ByteBudget {
+            std::size_t limit_;
+            std::size_t used_ = 0;
+            std::mutex mutex_;
+            std::condition_variable released_;
+
+        public:
+            // Bytes held until destroyed, however the work holding them ends
+            class Reservation {
+                ByteBudget* budget_;
+                std::size_t bytes_;
+
+            public:
+                Reservation(ByteBudget& budget, std::size_t bytes) : budget_(&budget), bytes_(bytes) {}
+                Reservation(Reservation&& other) noexcept
+                    : budget_(std::exchange(other.budget_, nullptr)), bytes_(other.bytes_) {}
+                Reservation& operator=(Reservation&&) = delete;
+                Reservation(const Reservation&) = delete;
+                Reservation& operator=(const Reservation&) = delete;
+
+                ~Reservation() {
+                    if (budget_ != nullptr) {
+                        budget_->release(bytes_);
+                    }
+                }
+            };
+
+            explicit ByteBudget(std::size_t limit) : limit_(limit) {}
+
+            Reservation reserve(std::size_t bytes) {
+                std::unique_lock lock(mutex_);
+                released_.wait(lock, [&]() { return used_ == 0 || used_ + bytes <= limit_; });
+                used_ += bytes;
+                return Reservation(*this, bytes);
+            }
+
+        private:
+            void release(std::size_t bytes) {
+                {
+                    std::lock_guard lock(mutex_);
+                    used_ -= bytes;
+                }
+                released_.notify_all();
+            }
+        };
+
+        void add_items(std::vector<BatchItem>& items, const std::filesystem::path& path, const std::vector<int>& days) {
+            if (!days.empty()) {
+                for (const int day : days) {
+                    items.push_back({day, path});
+                }
+                return;
+            }
+            const std::optional<int> day = day_from_path(path);
+            if (!day) {
+                throw std::runtime_error("Cannot tell the day of " + path.string() + ", pass day numbers");
+            }
+            items.push_back({*day, path});
+        }
+
+        void collect_directory(std::vector<BatchItem>& items, const std::filesystem::path& directory,
+                               const std::vector<int>& days) {
+            std::vector<std::filesystem::path> files;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(directory)) {
+                // Sidecars written by earlier runs sit next to their inputs
+                if (entry.is_regular_file() && !sidecar::is_sidecar(entry.path())) {
+                    files.push_back(entry.path());
+                }
+            }
+            std::sort(files.begin(), files.end());
+            for (const auto& file : files) {
+                add_items(items, file, days);
+            }
+        }
+
+        void collect_manifest(std::vector<BatchItem>& items, const std::filesystem::path& manifest,
+                              const std::vector<int>& days) {
+            std::ifstream in(manifest);
+            if (!in.is_open()) {
+                throw std::runtime_error("Error reading manifest " + manifest.string());
+            }
+            std::string line;
+            for (int line_number = 1; std::getline(in, line); ++line_number) {
+                line = line.substr(0, line.find('#'));
+                std::istringstream fields(line);
+                std::string first;
+                std::string second;
+                if (!(fields >> first)) {
+                    continue;
+                }
+                std::vector<int> line_days = days;
+                std::filesystem::path path = first;
+                if (fields >> second) {
+                    try {
+                        line_days = {std::stoi(first)};
+                    } catch (const std::exception&) {
+                        throw std::runtime_error(manifest.string() + ":" + std::to_string(line_number) +
+                                                 ": expected \"DAY PATH\"");
+                    }
+                    path = second;
+                }
+                if (path.is_relative()) {
+                    path = manifest.parent_path() / path;
+                }
+                add_items(items, path, line_days);
+            }
+        }
+
+        BatchResult solve_item(const BatchItem& item, const Input& input) {
+            BatchResult result{item, input.size(), std::nullopt, std::nullopt, 0.0, {}};
+            const auto it = days.find(item.day_number);
+            if (it == days.end()) {
+                result.error = "Day " + std::to_string(item.day_number) + " not implemented yet";
+                return result;
+            }
+            const Day& day = it->second;
+            const auto start = Clock::now();
+            try {
+                // Parse once for both parts where the day has a parse stage
+                const Day::Model model = day.has_parse_stage() ? day.parse_model(input.view()) : nullptr;
+                auto solve = [&](int part) { return model ? day.solve_parsed(part, model) : day.solve(part, input.view()); };
+                result.part1 = solve(1);
+                if (day.has_part(2)) {
+                    result.part2 = solve(2);
+                }
+            } catch (const std::exception& error) {
+                result.error = error.what();
+            }
+            result.solve_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            return result;
+        }
+
+        std::string csv_field(const std::string& text) {
+            if (text.find_first_of(",\"\n\r") == std::string::npos) {
+                return text;
+            }
+            std::string quoted = "\"";
+            for (const char ch : text) {
+                quoted += ch;
+                if (ch == '"') {
+                    quoted += '"';
+                }
+            }
+            return quoted + '"';
+        }
+
+        std::string json_string(const std::string& text) {
+            std::ostringstream out;
+            out << '"';
+            for (const char ch : text) {
+                if (ch == '"' || ch == '\\') {
+                    out << '\\' << ch;
+                } else if (static_cast<unsigned char>(ch) < 0x20) {
+                    out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(ch)
+                        << std::dec << std::setfill(' ');
+                } else {
+                    out << ch;
+                }
+            }
+            out << '"';
+            return out.str();
+        }
+
+        std::string answer_text(const std::optional<Answer>& answer) {
+            return answer ? answer->to_string() : std::string();
+        }
+    }
+
+    std::optional<int> day_from_path(const std::filesystem::path& path) {
+        // "day" not preceded by a letter, so "today1" does not count
+        static const std::regex pattern(R"((?:^|[^a-z])day0*([1-9][0-9]?)(?![0-9]))", std::regex::icase);
+        std::optional<int> day;
+        for (const auto& component : path) {
+            std::smatch match;
+            const std::string text = component.string();
+            if (std::regex_search(text, match, pattern)) {
+                day = std::stoi(match[1].str());
+            }
+        }
+        return day;
+    }
+
+    std::vector<BatchItem> collect_batch(const BatchOptions& options) {
+        std::vector<BatchItem> items;
+        for (const auto& source : options.sources) {
+            std::error_code error;
+            if (std::filesystem::is_directory(source, error)) {
+                collect_directory(items, source, options.days);
+            } else if (std::filesystem::is_regular_file(source, error)) {
+                collect_manifest(items, source, options.days);
+            } else {
+                throw std::runtime_error("Batch source not found: " + source.string());
+            }
+        }
+        return items;
+    }
+
+    std::vector<BatchResult> solve_batch(const std::vector<BatchItem>& items, const BatchOptions& options) {
+        std::vector<BatchResult> results(items.size());
+        ByteBudget budget(options.max_bytes_in_flight);
+        {
+            ThreadPool pool(options.threads);
+            for (std::size_t i = 0; i < items.size(); ++i) {
+                // A compressed input costs its decompressed size, not its file size
+                const std::size_t reserved = static_cast<std::size_t>(compression::expanded_size(items[i].path));
+                // Blocks the submitting thread, so at most the budget is in memory at once
+                pool.submit([&, i, reservation = budget.reserve(reserved)]() mutable {
+                    const ByteBudget::Reservation held = std::move(reservation);
+                    AOC2025_TRACE_ZONE("batch/file", items[i].day_number);
+                    try {
+                        const Input input = Input::open(items[i].path.string());
+                        results[i] = solve_item(items[i], input);
+                    } catch (const std::exception& error) {
+                        results[i].item = items[i];
+                        results[i].error = error.what();
+                    }
+                });
+            }
+        }
+        return results;
+    }
+
+    void write_batch_csv(std::ostream& out, const std::vector<BatchResult>& results) {
+        out << "day,file,bytes,part1,part2,ms,error\n";
+        for (const auto& result : results) {
+            out << result.item.day_number << ',' << csv_field(result.item.path.string()) << ',' << result.bytes << ','
+                << csv_field(answer_text(result.part1)) << ',' << csv_field(answer_text(result.part2)) << ','
+                << std::fixed << std::setprecision(3) << result.solve_ms << ',' << csv_field(result.error) << '\n';
+        }
+    }
+
+    void write_batch_json(std::ostream& out, const std::vector<BatchResult>& results, double seconds) {
+        std::uint64_t bytes = 0;
+        for (const auto& result : results) {
+            bytes += result.bytes;
+        }
+        out << "{\n  \"files\": " << results.size() << ", \"bytes\": " << bytes << ", \"seconds\": " << std::fixed
+            << std::setprecision(6) << seconds << ",\n  \"results\": [\n";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const BatchResult& result = results[i];
+            out << "    {\"day\": " << result.item.day_number << ", \"file\": " << json_string(result.item.path.string())
+                << ", \"bytes\": " << result.bytes << ", \"part1\": " << json_string(answer_text(result.part1))
+                << ", \"part2\": " << json_string(answer_text(result.part2)) << ", \"ms\": " << std::setprecision(3)
+                << result.solve_ms;
+            if (!result.error.empty()) {
+                out << ", \"error\": " << json_string(result.error);
+            }
+            out << '}' << (i + 1 < results.size() ? "," : "") << '\n';
+        }
+        out << "  ]\n}\n";
+    }
+
+    int run_batch(const BatchOptions& options, std::ostream& out, std::ostream& err) {
+        std::vector<BatchItem> items;
+        try {
+            items = collect_batch(options);
+        } catch (const std::exception& error) {
+            err << error.what() << '\n';
+            return 1;
+        }
+
+        const auto start = Clock::now();
+        const std::vector<BatchResult> results = solve_batch(items, options);
+        const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::ofstream file;
+        std::ostream* target = &out;
+        if (!options.output_path.empty() && options.output_path != "-") {
+            file.open(options.output_path);
+            if (!file.is_open()) {
+                err << "Error writing " << options.output_path << '\n';
+                return 1;
+            }
+            target = &file;
+        }
+        if (options.format == BatchFormat::kJson) {
+            write_batch_json(*target, results, seconds);
+        } else {
+            write_batch_csv(*target, results);
+        }
+
+        std::uint64_t bytes = 0;
+        std::size_t failed = 0;
+        for (const auto& result : results) {
+            bytes += result.bytes;
+            failed += result.error.empty() ? 0 : 1;
+        }
+        const double rate = seconds > 0.0 ? 1.0 / seconds : 0.0;
+        err << "Batch: " << results.size() << " files (" << failed << " failed), " << bytes << " bytes in "
+            << std::fixed << std::setprecision(3) << seconds << " s, " << std::setprecision(1)
+            << static_cast<double>(results.size()) * rate << " files/s, "
+            << static_cast<double>(bytes) * rate / 1e6 << " MB/s\n";
+        return failed == 0 ? 0 : 2;
+    }
+}
@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include "aoc2025.hpp"
+#include "batch.hpp"
+#include "day1.hpp"
+#include "day3.hpp"
+#include "model_cache.hpp"
+
+namespace batch_tests {
+
+static std::filesystem::path make_directory(const std::string& name) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(path);
+    std::filesystem::create_directories(path);
+    return path;
+}
+
+static void write_file(const std::filesystem::path& path, const std::string& contents) {
+    std::filesystem::create_directories(path.parent_path());
+    std::ofstream file(path, std::ios::binary);
+    file << contents;
+}
+
+TEST_CASE("Batch: day_from_path - Path Components", "[batch][component]") {
+    // Assert
+    REQUIRE(aoc2025::day_from_path("inputs/alice/day3.txt") == 3);
+    REQUIRE(aoc2025::day_from_path("day12/bob") == 12);
+    REQUIRE(aoc2025::day_from_path("Day01_input") == 1);
+    REQUIRE(aoc2025::day_from_path("inputs/alice-day2.txt") == 2);
+    REQUIRE_FALSE(aoc2025::day_from_path("inputs/today1.txt").has_value());
+    REQUIRE_FALSE(aoc2025::day_from_path("day123").has_value());
+}
+
+TEST_CASE("Batch: collect_batch - Directory And Manifest", "[batch][component]") {
+    // Arrange
+    const auto root = make_directory("aoc2025_batch_collect");
+    write_file(root / "day1" / "b.txt", "R1\n");
+    write_file(root / "day1" / "a.txt", "L1\n");
+    write_file(root / "manifest.txt", "# comment\n3 day1/a.txt\nday1/b.txt\n\n");
+    aoc2025::BatchOptions options;
+    options.sources = {root / "day1", root / "manifest.txt"};
+    
+    // Act
+    const auto items = aoc2025::collect_batch(options);
+    
+    // Assert
+    REQUIRE(items.size() == 4);
+    REQUIRE(items[0].path.filename() == "a.txt");
+    REQUIRE(items[1].path.filename() == "b.txt");
+    REQUIRE(items[2].day_number == 3);
+    REQUIRE(items[3].day_number == 1);
+    REQUIRE(items[3].path == root / "day1/b.txt");
+    std::filesystem::remove_all(root);
+}
+
+TEST_CASE("Batch: collect_batch - Unknown Day", "[batch][component]") {
+    // Arrange
+    const auto root = make_directory("aoc2025_batch_unknown");
+    write_file(root / "input.txt", "L1\n");
+    aoc2025::BatchOptions options;
+    options.sources = {root};
+    
+    // Act & Assert
+    REQUIRE_THROWS_AS(aoc2025::collect_batch(options), std::runtime_error);
+    options.days = {1};
+    REQUIRE(aoc2025::collect_batch(options).size() == 1);
+    std::filesystem::remove_all(root);
+}
+
+TEST_CASE("Batch: solve_batch - Results In Order Under A Small Budget", "[batch][integration]") {
+    // Arrange
+    aoc2025::register_day(Day1::Day1);
+    aoc2025::register_day(Day3::Day3);
+    const auto root = make_directory("aoc2025_batch_solve");
+    write_file(root / "day1.txt", "L68\nL30\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82");
+    write_file(root / "day3.txt", "987654321111111\n123456789\n999888777");
+    write_file(root / "day1-bad.txt", "X\n");
+    aoc2025::BatchOptions options;
+    options.sources = {root};
+    options.threads = 3;
+    options.max_bytes_in_flight = 16;
+    
+    // Act
+    const auto results = aoc2025::solve_batch(aoc2025::collect_batch(options), options);
+    std::ostringstream csv;
+    aoc2025::write_batch_csv(csv, results);
+    
+    // Assert
+    REQUIRE(results.size() == 3);
+    REQUIRE_FALSE(results[0].error.empty());
+    REQUIRE(results[1].part1 == aoc2025::Answer(3));
+    REQUIRE(results[1].part2 == aoc2025::Answer(6));
+    REQUIRE(results[2].part1 == aoc2025::Answer(286));
+    REQUIRE(csv.str().rfind("day,file,bytes,part1,part2,ms,error\n", 0) == 0);
+    REQUIRE(csv.str().find(",3,6,") != std::string::npos);
+    std::filesystem::remove_all(root);
+}
+
+TEST_CASE("Batch: collect_batch - Skips Model Sidecars", "[batch][integration]") {
+    // Arrange: a sidecar left by an earlier run, plus an interrupted store
+    aoc2025::register_day(Day3::Day3);
+    const auto root = make_directory("aoc2025_batch_sidecar");
+    const auto input = root / "day3" / "data.txt";
+    write_file(input, "987654321111111\n123456789\n999888777");
+    const aoc2025::Day& day = aoc2025::days.at(3);
+    const auto key = aoc2025::SidecarKey::for_file(day, input, 0);
+    REQUIRE(key.has_value());
+    REQUIRE(aoc2025::sidecar::store(day, input, *key, day.parse_model("987654321111111\n")));
+    write_file(root / "day3" / "data.txt.aocbin.tmp.42", "partial");
+    aoc2025::BatchOptions options;
+    options.sources = {root};
+
+    // Act
+    const auto items = aoc2025::collect_batch(options);
+    const auto results = aoc2025::solve_batch(items, options);
+
+    // Assert
+    REQUIRE(std::filesystem::exists(aoc2025::sidecar::path_for(input)));
+    REQUIRE(items.size() == 1);
+    REQUIRE(items[0].path == input);
+    REQUIRE(results.size() == 1);
+    REQUIRE(results[0].error.empty());
+    REQUIRE(results[0].part1 == aoc2025::Answer(286));
+    std::filesystem::remove_all(root);
+}
+
+} // namespace batch_tests
@@ -0,0 +1,174 @@
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "bench_stats.hpp"
+
+namespace {
+    struct Options {
+        std::string before_path;
+        std::string after_path;
+        std::string filter;
+        aoc2025::bench::CompareOptions compare;
+    };
+
+    void print_usage(const char* program) {
+        std::cerr << "Usage: " << program << " BEFORE.json AFTER.json [options]\n"
+                  << "Compares two bench_runner --json runs sample by sample.\n"
+                  << "  --filter TEXT     only compare benchmarks whose name contains TEXT\n"
+                  << "  --alpha P         significance level, the interval is 1 - P (default 0.05)\n"
+                  << "  --threshold PCT   smallest speedup reported as a change (default 10)\n"
+                  << "  --resamples N     bootstrap resamples (default 10000)\n"
+                  << "  --seed N          bootstrap seed (default 2025)\n";
+    }
+
+    bool parse_options(int argc, char* argv[], Options& options) {
+        std::vector<std::string> paths;
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                return i + 1 < argc ? argv[++i] : std::string();
+            };
+            if (arg == "--filter") {
+                options.filter = next();
+            } else if (arg == "--alpha") {
+                options.compare.alpha = std::atof(next().c_str());
+            } else if (arg == "--threshold") {
+                options.compare.min_change = std::atof(next().c_str()) / 100.0;
+            } else if (arg == "--resamples") {
+                options.compare.resamples = std::atoi(next().c_str());
+            } else if (arg == "--seed") {
+                options.compare.seed = std::strtoull(next().c_str(), nullptr, 10);
+            } else if (!arg.empty() && arg[0] != '-') {
+                paths.push_back(arg);
+            } else {
+                return false;
+            }
+        }
+        if (paths.size() != 2) {
+            return false;
+        }
+        options.before_path = paths[0];
+        options.after_path = paths[1];
+        return options.compare.alpha > 0.0 && options.compare.alpha < 1.0 && options.compare.resamples > 0 &&
+               options.compare.min_change >= 0.0;
+    }
+
+    std::vector<aoc2025::bench::SampleSet> load(const std::string& path, const std::string& filter) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Error reading " + path);
+        }
+        std::ostringstream text;
+        text << file.rdbuf();
+        try {
+            auto results = aoc2025::bench::parse_results_json(text.str());
+            std::erase_if(results, [&](const aoc2025::bench::SampleSet& result) {
+                return !filter.empty() && result.name.find(filter) == std::string::npos;
+            });
+            return results;
+        } catch (const std::exception& error) {
+            throw std::runtime_error(path + ": " + error.what());
+        }
+    }
+
+    // "1.23 ms" with a unit that keeps three or four significant digits
+    std::string format_time(double ns) {
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(2);
+        if (ns >= 1e9) {
+            out << ns / 1e9 << " s";
+        } else if (ns >= 1e6) {
+            out << ns / 1e6 << " ms";
+        } else if (ns >= 1e3) {
+            out << ns / 1e3 << " us";
+        } else {
+            out << ns << " ns";
+        }
+        return out.str();
+    }
+
+    const char* verdict_name(aoc2025::bench::Verdict verdict) {
+        switch (verdict) {
+            case aoc2025::bench::Verdict::kFaster: return "faster";
+            case aoc2025::bench::Verdict::kSlower: return "SLOWER";
+            case aoc2025::bench::Verdict::kNoise: return "noise";
+            case aoc2025::bench::Verdict::kOnlyBefore: return "only before";
+            case aoc2025::bench::Verdict::kOnlyAfter: return "only after";
+        }
+        return "";
+    }
+
+    void print_table(std::ostream& out, const std::vector<aoc2025::bench::KernelChange>& changes, const Options& options) {
+        const int confidence = static_cast<int>(std::lround((1.0 - options.compare.alpha) * 100.0));
+        out << std::left << std::setw(30) << "benchmark" << std::right << std::setw(6) << "size" << std::setw(12)
+            << "before" << std::setw(12) << "after" << std::setw(10) << "speedup" << std::setw(19)
+            << (std::to_string(confidence) + "% interval") << std::setw(10) << "p" << "  verdict\n";
+
+        int faster = 0;
+        int slower = 0;
+        int noise = 0;
+        double log_speedups = 0.0;
+        int compared = 0;
+        for (const auto& change : changes) {
+            out << std::left << std::setw(30) << change.name << std::right << std::setw(6)
+                << aoc2025::format_size(change.bytes) << std::setw(12)
+                << (change.samples_before > 0 ? format_time(change.median_before_ns) : "-") << std::setw(12)
+                << (change.samples_after > 0 ? format_time(change.median_after_ns) : "-");
+            if (change.samples_before > 0 && change.samples_after > 0) {
+                std::ostringstream interval;
+                interval << std::fixed << std::setprecision(3) << '[' << change.interval.low << ", "
+                         << change.interval.high << ']';
+                out << std::fixed << std::setprecision(3) << std::setw(9) << change.speedup << 'x' << std::setw(19)
+                    << interval.str() << std::setw(10) << std::setprecision(4) << change.test.p;
+                log_speedups += std::log(change.speedup);
+                ++compared;
+            } else {
+                out << std::setw(10) << "" << std::setw(19) << "" << std::setw(10) << "";
+            }
+            out << "  " << verdict_name(change.verdict) << '\n';
+            faster += change.verdict == aoc2025::bench::Verdict::kFaster ? 1 : 0;
+            slower += change.verdict == aoc2025::bench::Verdict::kSlower ? 1 : 0;
+            noise += change.verdict == aoc2025::bench::Verdict::kNoise ? 1 : 0;
+        }
+
+        out << '\n' << faster << " faster, " << slower << " slower, " << noise << " within the noise";
+        if (compared > 0) {
+            out << "; geometric mean speedup " << std::fixed << std::setprecision(3)
+                << std::exp(log_speedups / compared) << 'x';
+        }
+        out << '\n';
+        for (const auto& change : changes) {
+            const bool few = (change.samples_before > 0 && change.samples_before < 8) ||
+                             (change.samples_after > 0 && change.samples_after < 8);
+            if (few) {
+                out << "Fewer than 8 samples on a side make the test unreliable; raise bench_runner --samples\n";
+                break;
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    try {
+        const auto before = load(options.before_path, options.filter);
+        const auto after = load(options.after_path, options.filter);
+        print_table(std::cout, aoc2025::bench::compare_runs(before, after, options.compare), options);
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+    return 0;
+}
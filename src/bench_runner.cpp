@@ -0,0 +1,291 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "alloc_stats.hpp"
+#include "bench.hpp"
+#include "generator.hpp"
+
+namespace {
+    struct Options {
+        std::string filter;
+        std::size_t min_bytes = std::size_t{1} << 10;
+        std::size_t max_bytes = std::size_t{16} << 20;
+        std::size_t factor = 4;
+        int min_samples = 5;
+        double min_time_ms = 200.0;
+        std::uint64_t seed = 2025;
+        std::string json_path;
+        std::string baseline_path;
+        std::string write_baseline_path;
+        double tolerance = 0.25;
+        bool list_only = false;
+    };
+
+    struct Result {
+        std::string name;
+        std::size_t bytes;
+        std::vector<double> samples_ns;
+        std::uint64_t checksum;
+        std::uint64_t allocations = 0;
+
+        double median_ns() const {
+            std::vector<double> sorted = samples_ns;
+            std::sort(sorted.begin(), sorted.end());
+            const std::size_t mid = sorted.size() / 2;
+            return sorted.size() % 2 == 1 ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2.0;
+        }
+    };
+
+    void print_usage(const char* program) {
+        std::cerr << "Usage: " << program << " [options]\n"
+                  << "  --filter TEXT     only run benchmarks whose name contains TEXT\n"
+                  << "  --min SIZE        smallest input size (default 1K)\n"
+                  << "  --max SIZE        largest input size (default 16M, e.g. 1G)\n"
+                  << "  --factor N        size multiplier between steps (default 4)\n"
+                  << "  --samples N       minimum number of timed samples (default 5)\n"
+                  << "  --min-time MS     minimum total timed duration per size (default 200)\n"
+                  << "  --seed N          seed for synthetic inputs (default 2025)\n"
+                  << "  --json FILE       write raw samples as JSON\n"
+                  << "  --baseline FILE   compare medians and allocations with FILE, fail on regressions\n"
+                  << "  --tolerance PCT   slowdown --baseline accepts (default 25)\n"
+                  << "  --write-baseline FILE  record medians and allocations as a new baseline\n"
+                  << "  --list            list benchmarks and exit\n";
+    }
+
+    bool parse_options(int argc, char* argv[], Options& options) {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                return i + 1 < argc ? argv[++i] : std::string();
+            };
+            if (arg == "--filter") {
+                options.filter = next();
+            } else if (arg == "--min") {
+                options.min_bytes = aoc2025::parse_size(next());
+            } else if (arg == "--max") {
+                options.max_bytes = aoc2025::parse_size(next());
+            } else if (arg == "--factor") {
+                options.factor = static_cast<std::size_t>(std::atoi(next().c_str()));
+            } else if (arg == "--samples") {
+                options.min_samples = std::atoi(next().c_str());
+            } else if (arg == "--min-time") {
+                options.min_time_ms = std::atof(next().c_str());
+            } else if (arg == "--seed") {
+                options.seed = std::strtoull(next().c_str(), nullptr, 10);
+            } else if (arg == "--json") {
+                options.json_path = next();
+            } else if (arg == "--baseline") {
+                options.baseline_path = next();
+            } else if (arg == "--tolerance") {
+                options.tolerance = std::atof(next().c_str()) / 100.0;
+            } else if (arg == "--write-baseline") {
+                options.write_baseline_path = next();
+            } else if (arg == "--list") {
+                options.list_only = true;
+            } else {
+                return false;
+            }
+        }
+        return options.min_bytes > 0 && options.max_bytes >= options.min_bytes &&
+               options.factor > 1 && options.min_samples > 0 && options.tolerance >= 0.0;
+    }
+
+    Result measure(const aoc2025::bench::Benchmark& benchmark, std::size_t bytes, const Options& options) {
+        using Clock = std::chrono::steady_clock;
+
+        Result result{benchmark.name, bytes, {}, 0};
+        const aoc2025::bench::Kernel kernel = benchmark.setup(bytes, options.seed);
+
+        // Warm-up run, also touches the input so page faults are not timed
+        result.checksum = kernel();
+        {
+            const aoc2025::alloc::Scope scope;
+            static_cast<void>(kernel());
+            result.allocations = scope.stop().count;
+        }
+
+        double total_ns = 0.0;
+        while (static_cast<int>(result.samples_ns.size()) < options.min_samples ||
+               total_ns < options.min_time_ms * 1e6) {
+            const auto start = Clock::now();
+            const std::uint64_t checksum = kernel();
+            const auto stop = Clock::now();
+            if (checksum != result.checksum) {
+                std::cerr << benchmark.name << ": checksum changed between runs\n";
+            }
+            const double elapsed = std::chrono::duration<double, std::nano>(stop - start).count();
+            result.samples_ns.push_back(elapsed);
+            total_ns += elapsed;
+        }
+        return result;
+    }
+
+    // Dependent multiply-xor chain over a 1 MiB table: a fixed mix of
+    // arithmetic and cached loads that does not change with the solvers
+    aoc2025::bench::Benchmark calibration() {
+        return {aoc2025::bench::kCalibration, [](std::size_t input_bytes, std::uint64_t seed) -> aoc2025::bench::Kernel {
+            aoc2025::gen::Random rng(seed);
+            auto table = std::make_shared<std::vector<std::uint64_t>>(input_bytes / sizeof(std::uint64_t));
+            for (std::uint64_t& value : *table) {
+                value = rng.next();
+            }
+            return [table]() {
+                std::uint64_t state = 0;
+                for (int round = 0; round < 4; ++round) {
+                    for (const std::uint64_t value : *table) {
+                        state = (state ^ value) * 0x9E3779B97F4A7C15ULL;
+                        state ^= state >> 29;
+                    }
+                }
+                return state;
+            };
+        }};
+    }
+
+    std::vector<aoc2025::bench::BaselineEntry> to_entries(const std::vector<Result>& results) {
+        std::vector<aoc2025::bench::BaselineEntry> entries;
+        for (const Result& result : results) {
+            entries.push_back({result.name, result.bytes, result.median_ns(), result.allocations});
+        }
+        return entries;
+    }
+
+    // Table of every benchmark against the baseline; returns the number of regressions
+    int report(std::ostream& out, const std::vector<aoc2025::bench::Comparison>& comparisons, const Options& options,
+               bool check_allocations) {
+        out << "\nAgainst " << options.baseline_path << " (tolerance " << std::setprecision(0)
+            << options.tolerance * 100.0 << "%";
+        if (!check_allocations) {
+            out << ", allocations not counted in this build";
+        }
+        out << "):\n";
+        int regressions = 0;
+        for (const auto& comparison : comparisons) {
+            out << "  " << std::left << std::setw(30) << comparison.name << std::right << std::setw(6)
+                << aoc2025::format_size(comparison.bytes) << std::setw(12) << std::setprecision(3)
+                << comparison.median_ns / 1e6 << " ms";
+            if (!comparison.in_baseline) {
+                out << "  not in the baseline\n";
+                continue;
+            }
+            out << "  expected " << std::setw(9) << comparison.expected_ns / 1e6 << " ms " << std::showpos
+                << std::setw(7) << std::setprecision(1) << comparison.change() * 100.0 << '%' << std::noshowpos;
+            if (check_allocations) {
+                out << std::setw(8) << comparison.allocations << " allocs (" << comparison.baseline_allocations << ")";
+            }
+            if (comparison.slower) {
+                out << "  SLOWER";
+            }
+            if (comparison.more_allocations) {
+                out << "  MORE ALLOCATIONS";
+            }
+            out << '\n';
+            regressions += comparison.slower || comparison.more_allocations ? 1 : 0;
+        }
+        if (regressions > 0) {
+            out << regressions << " performance regression" << (regressions == 1 ? "" : "s")
+                << "; if intended, record a new baseline with --write-baseline"
+                << " (the perf-baseline build target)\n";
+        }
+        return regressions;
+    }
+
+    void print_result(const Result& result) {
+        const double median = result.median_ns();
+        const double mb_per_s = median > 0.0 ? static_cast<double>(result.bytes) / median * 1e3 : 0.0;
+        std::cout << std::left << std::setw(28) << result.name
+                  << std::right << std::setw(8) << aoc2025::format_size(result.bytes)
+                  << std::setw(16) << std::fixed << std::setprecision(0) << median << " ns"
+                  << std::setw(12) << std::setprecision(1) << mb_per_s << " MB/s"
+                  << std::setw(6) << result.samples_ns.size() << " samples\n";
+    }
+
+    void write_json(const std::string& path, const std::vector<Result>& results) {
+        std::ofstream out(path);
+        if (!out.is_open()) {
+            std::cerr << "Error writing " << path << '\n';
+            return;
+        }
+        out << "{\n  \"results\": [\n";
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const Result& result = results[i];
+            out << "    {\"name\": \"" << result.name << "\", \"bytes\": " << result.bytes
+                << ", \"checksum\": " << result.checksum << ", \"allocations\": " << result.allocations
+                << ", \"samples_ns\": [";
+            for (std::size_t s = 0; s < result.samples_ns.size(); ++s) {
+                out << (s == 0 ? "" : ", ") << std::fixed << std::setprecision(0) << result.samples_ns[s];
+            }
+            out << "]}" << (i + 1 < results.size() ? "," : "") << '\n';
+        }
+        out << "  ]\n}\n";
+    }
+}
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    std::vector<aoc2025::bench::BaselineEntry> baseline;
+    if (!options.baseline_path.empty()) {
+        std::ifstream file(options.baseline_path);
+        if (!file.is_open()) {
+            std::cerr << "Error reading " << options.baseline_path << '\n';
+            return 1;
+        }
+        try {
+            baseline = aoc2025::bench::parse_baseline(file);
+        } catch (const std::exception& error) {
+            std::cerr << options.baseline_path << ": " << error.what() << '\n';
+            return 1;
+        }
+    }
+
+    std::vector<Result> results;
+    if (!options.list_only && (!options.baseline_path.empty() || !options.write_baseline_path.empty())) {
+        results.push_back(measure(calibration(), std::size_t{1} << 20, options));
+        print_result(results.back());
+    }
+    for (const auto& benchmark : aoc2025::bench::benchmarks()) {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos) {
+            continue;
+        }
+        if (options.list_only) {
+            std::cout << benchmark.name << '\n';
+            continue;
+        }
+        for (const std::size_t bytes : aoc2025::bench::sweep_sizes(options.min_bytes, options.max_bytes, options.factor)) {
+            results.push_back(measure(benchmark, bytes, options));
+            print_result(results.back());
+        }
+    }
+
+    if (!options.json_path.empty()) {
+        write_json(options.json_path, results);
+    }
+    if (!options.write_baseline_path.empty()) {
+        std::ofstream file(options.write_baseline_path);
+        if (!file.is_open()) {
+            std::cerr << "Error writing " << options.write_baseline_path << '\n';
+            return 1;
+        }
+        aoc2025::bench::write_baseline(file, to_entries(results));
+    }
+    if (!options.baseline_path.empty()) {
+        const bool check_allocations = aoc2025::alloc::tracking_compiled();
+        const auto comparisons =
+            aoc2025::bench::compare(baseline, to_entries(results), options.tolerance, check_allocations);
+        return report(std::cout, comparisons, options, check_allocations) == 0 ? 0 : 1;
+    }
+    return 0;
+}
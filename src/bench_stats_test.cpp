@@ -0,0 +1,124 @@
+#include <catch2/catch_test_macros.hpp>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "bench_stats.hpp"
+#include "generator.hpp"
+
+namespace bench_stats_tests {
+
+// Samples around center with spread noise, as timings scatter
+static std::vector<double> timings(double center, double spread, int count, std::uint64_t seed) {
+    aoc2025::gen::Random rng(seed);
+    std::vector<double> samples;
+    for (int i = 0; i < count; ++i) {
+        samples.push_back(center + spread * (static_cast<double>(rng.between(0, 1000)) / 500.0 - 1.0));
+    }
+    return samples;
+}
+
+TEST_CASE("Bench Stats: parse_results_json - bench_runner Output", "[bench][component]") {
+    // Arrange
+    const std::string json =
+        "{\n  \"results\": [\n"
+        "    {\"name\": \"day3/Bank::max_n\", \"bytes\": 1048576, \"checksum\": 12, \"allocations\": 0, "
+        "\"samples_ns\": [140, 150, 1.2e2]},\n"
+        "    {\"name\": \"day1/\\\"quoted\\\"\", \"extra\": {\"a\": [true, null]}, \"bytes\": 4096, \"samples_ns\": [5]}\n"
+        "  ],\n  \"machine\": \"x\"\n}\n";
+
+    // Act
+    const auto results = aoc2025::bench::parse_results_json(json);
+
+    // Assert
+    REQUIRE(results.size() == 2);
+    REQUIRE(results[0].name == "day3/Bank::max_n");
+    REQUIRE(results[0].bytes == 1048576);
+    REQUIRE(results[0].samples_ns == std::vector<double>{140, 150, 120});
+    REQUIRE(results[1].name == "day1/\"quoted\"");
+    REQUIRE(results[1].samples_ns.size() == 1);
+}
+
+TEST_CASE("Bench Stats: parse_results_json - Malformed Input", "[bench][component]") {
+    for (const std::string json : {"", "{\"results\": [", "{\"results\": [{\"name\": \"x\", \"samples_ns\": [1,]}]}",
+                                   "{\"results\": [{\"name\": \"x\", \"samples_ns\": []}]}", "{} extra"}) {
+        // Act & Assert
+        REQUIRE_THROWS_AS(aoc2025::bench::parse_results_json(json), std::runtime_error);
+    }
+}
+
+TEST_CASE("Bench Stats: median - Odd And Even Counts", "[bench][component]") {
+    // Assert
+    REQUIRE(aoc2025::bench::median({3, 1, 2}) == 2.0);
+    REQUIRE(aoc2025::bench::median({4, 1, 3, 2}) == 2.5);
+    REQUIRE(aoc2025::bench::median({}) == 0.0);
+}
+
+TEST_CASE("Bench Stats: mann_whitney - Known Values", "[bench][component]") {
+    // Act
+    const auto separated = aoc2025::bench::mann_whitney({1, 2, 3, 4, 5, 6, 7, 8}, {9, 10, 11, 12, 13, 14, 15, 16});
+    const auto identical = aoc2025::bench::mann_whitney({5, 5, 5, 5}, {5, 5, 5, 5});
+    const auto interleaved = aoc2025::bench::mann_whitney({1, 3, 5, 7, 9, 11}, {2, 4, 6, 8, 10, 12});
+
+    // Assert: fully separated samples of 8 give U = 0, z about -3.31
+    REQUIRE(separated.u == 0.0);
+    REQUIRE(separated.z < -3.3);
+    REQUIRE(separated.z > -3.4);
+    REQUIRE(separated.p < 0.001);
+    REQUIRE(identical.p == 1.0);
+    REQUIRE(interleaved.p > 0.5);
+}
+
+TEST_CASE("Bench Stats: compare_runs - Real Change, Noise And Missing", "[bench][component]") {
+    // Arrange: max_n 20% faster, rotate unchanged with the same scatter
+    const std::vector<aoc2025::bench::SampleSet> before{
+        {"day3/Bank::max_n", 1 << 20, timings(1000.0, 50.0, 30, 1)},
+        {"day1/Dial::rotate", 1 << 20, timings(500.0, 50.0, 30, 2)},
+        {"day2/Ranges", 1 << 20, timings(300.0, 10.0, 10, 3)},
+    };
+    const std::vector<aoc2025::bench::SampleSet> after{
+        {"day1/Dial::rotate", 1 << 20, timings(500.0, 50.0, 30, 4)},
+        {"day3/Bank::max_n", 1 << 20, timings(800.0, 50.0, 30, 5)},
+        {"day3/Banks", 1 << 20, timings(300.0, 10.0, 10, 6)},
+    };
+
+    // Act
+    const auto changes = aoc2025::bench::compare_runs(before, after, {0.05, 0.0, 2000, 7});
+    const auto slower = aoc2025::bench::compare_runs(after, before, {0.05, 0.0, 2000, 7});
+    const auto thresholded = aoc2025::bench::compare_runs(before, after, {0.05, 0.5, 2000, 7});
+    const auto defaults = aoc2025::bench::compare_runs(before, after);
+
+    // Assert
+    REQUIRE(changes.size() == 4);
+    REQUIRE(changes[0].verdict == aoc2025::bench::Verdict::kFaster);
+    REQUIRE(changes[0].speedup > 1.15);
+    REQUIRE(changes[0].interval.low > 1.0);
+    REQUIRE(changes[0].interval.contains(changes[0].speedup));
+    REQUIRE(changes[1].verdict == aoc2025::bench::Verdict::kNoise);
+    REQUIRE(changes[1].interval.contains(1.0));
+    REQUIRE(changes[2].verdict == aoc2025::bench::Verdict::kOnlyBefore);
+    REQUIRE(changes[3].verdict == aoc2025::bench::Verdict::kOnlyAfter);
+    REQUIRE(changes[3].name == "day3/Banks");
+    REQUIRE(slower[1].verdict == aoc2025::bench::Verdict::kSlower);
+    REQUIRE(thresholded[0].verdict == aoc2025::bench::Verdict::kNoise);
+    REQUIRE(defaults[0].verdict == aoc2025::bench::Verdict::kFaster);
+    REQUIRE(defaults[1].verdict == aoc2025::bench::Verdict::kNoise);
+}
+
+TEST_CASE("Bench Stats: bootstrap_speedup - Deterministic", "[bench][component]") {
+    // Arrange
+    const auto before = timings(1000.0, 100.0, 20, 8);
+    const auto after = timings(900.0, 100.0, 20, 9);
+
+    // Act
+    const auto first = aoc2025::bench::bootstrap_speedup(before, after, 0.95, 1000, 3);
+    const auto second = aoc2025::bench::bootstrap_speedup(before, after, 0.95, 1000, 3);
+    const auto narrow = aoc2025::bench::bootstrap_speedup(before, after, 0.5, 1000, 3);
+
+    // Assert
+    REQUIRE(first.low == second.low);
+    REQUIRE(first.high == second.high);
+    REQUIRE(first.low <= narrow.low);
+    REQUIRE(narrow.high <= first.high);
+}
+
+} // namespace bench_stats_tests
@@ -0,0 +1,102 @@
+#include <catch2/catch_test_macros.hpp>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+
+namespace bench_tests {
+
+TEST_CASE("Bench: sweep_sizes - Stops Before Overflow", "[bench][component]") {
+    // Arrange
+    const std::size_t max = std::numeric_limits<std::size_t>::max();
+
+    // Act
+    const auto sizes = aoc2025::bench::sweep_sizes(1 << 10, 16 << 10, 4);
+    const auto huge = aoc2025::bench::sweep_sizes(std::size_t{1} << 62, max, 4);
+
+    // Assert
+    REQUIRE(sizes == std::vector<std::size_t>{1 << 10, 4 << 10, 16 << 10});
+    REQUIRE(huge == std::vector<std::size_t>{std::size_t{1} << 62});
+    REQUIRE(aoc2025::bench::sweep_sizes(max, max, 2) == std::vector<std::size_t>{max});
+}
+
+TEST_CASE("Bench: parse_baseline - Round Trip", "[bench][component]") {
+    // Arrange
+    const std::vector<aoc2025::bench::BaselineEntry> entries{
+        {aoc2025::bench::kCalibration, 1 << 20, 1500000.0, 0},
+        {"day3/Banks", 1 << 20, 1100000.0, 10383},
+        {"day1/part1", 4096, 2000.0, 1},
+    };
+    std::ostringstream written;
+
+    // Act
+    aoc2025::bench::write_baseline(written, entries);
+    std::istringstream in("\n  # comment\n" + written.str());
+    const auto parsed = aoc2025::bench::parse_baseline(in);
+
+    // Assert
+    REQUIRE(parsed.size() == entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        REQUIRE(parsed[i].name == entries[i].name);
+        REQUIRE(parsed[i].bytes == entries[i].bytes);
+        REQUIRE(parsed[i].median_ns == entries[i].median_ns);
+        REQUIRE(parsed[i].allocations == entries[i].allocations);
+    }
+}
+
+TEST_CASE("Bench: parse_baseline - Malformed Lines", "[bench][component]") {
+    for (const std::string line : {"day1/part1 1M 100", "day1/part1 1X 100 0", "day1/part1 1M 100 0 extra",
+                                   "day1/part1 1M -5 0", "day1/part1 1M slow 0"}) {
+        // Arrange
+        std::istringstream in("calibration 1M 100 0\n" + line + "\n");
+
+        // Act & Assert
+        REQUIRE_THROWS_AS(aoc2025::bench::parse_baseline(in), std::runtime_error);
+    }
+}
+
+TEST_CASE("Bench: compare - Scales By Calibration", "[bench][component]") {
+    // Arrange: this machine runs the calibration kernel twice as slow
+    const std::vector<aoc2025::bench::BaselineEntry> baseline{
+        {aoc2025::bench::kCalibration, 1 << 20, 1000.0, 0},
+        {"day2/part1", 1 << 20, 5000.0, 1},
+        {"day2/part2", 1 << 20, 5000.0, 1},
+    };
+    const std::vector<aoc2025::bench::BaselineEntry> current{
+        {aoc2025::bench::kCalibration, 1 << 20, 2000.0, 0},
+        {"day2/part1", 1 << 20, 11000.0, 1},
+        {"day2/part2", 1 << 20, 13000.0, 1},
+        {"day2/Ranges", 1 << 20, 3000.0, 1},
+    };
+
+    // Act
+    const auto comparisons = aoc2025::bench::compare(baseline, current, 0.25);
+
+    // Assert
+    REQUIRE(comparisons.size() == 3);
+    REQUIRE(comparisons[0].expected_ns == 10000.0);
+    REQUIRE_FALSE(comparisons[0].slower);
+    REQUIRE(comparisons[1].slower);
+    REQUIRE(comparisons[1].change() > 0.29);
+    REQUIRE_FALSE(comparisons[2].in_baseline);
+    REQUIRE_FALSE(comparisons[2].slower);
+}
+
+TEST_CASE("Bench: compare - Extra Allocations Fail", "[bench][component]") {
+    // Arrange
+    const std::vector<aoc2025::bench::BaselineEntry> baseline{{"day3/Banks", 1 << 20, 1000.0, 3}};
+    const std::vector<aoc2025::bench::BaselineEntry> current{{"day3/Banks", 1 << 20, 1000.0, 4}};
+
+    // Act
+    const auto checked = aoc2025::bench::compare(baseline, current, 0.25);
+    const auto unchecked = aoc2025::bench::compare(baseline, current, 0.25, false);
+
+    // Assert
+    REQUIRE(checked[0].more_allocations);
+    REQUIRE_FALSE(checked[0].slower);
+    REQUIRE_FALSE(unchecked[0].more_allocations);
+}
+
+} // namespace bench_tests
@@ -0,0 +1,248 @@
+#include "chunk_reader.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+
+#include "compression.hpp"
+#include "trace.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+namespace aoc2025 {
+    bool ChunkQueue::push(std::string chunk) {
+        std::unique_lock lock(mutex_);
+        changed_.wait(lock, [this]() { return cancelled_ || chunks_.size() < depth_; });
+        if (cancelled_) {
+            return false;
+        }
+        chunks_.push_back(std::move(chunk));
+        changed_.notify_all();
+        return true;
+    }
+
+    void ChunkQueue::close(std::exception_ptr error) {
+        std::lock_guard lock(mutex_);
+        closed_ = true;
+        error_ = error;
+        changed_.notify_all();
+    }
+
+    void ChunkQueue::cancel() {
+        std::lock_guard lock(mutex_);
+        cancelled_ = true;
+        chunks_.clear();
+        changed_.notify_all();
+    }
+
+    std::optional<std::string> ChunkQueue::pop() {
+        std::unique_lock lock(mutex_);
+        changed_.wait(lock, [this]() { return closed_ || !chunks_.empty(); });
+        if (!chunks_.empty()) {
+            std::string chunk = std::move(chunks_.front());
+            chunks_.pop_front();
+            changed_.notify_all();
+            return chunk;
+        }
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+        return std::nullopt;
+    }
+
+    namespace {
+#if defined(__unix__) || defined(__APPLE__)
+        // Wait until fd has data or wake_fd is written to; false when woken
+        bool wait_readable(int fd, int wake_fd) {
+            for (;;) {
+                pollfd fds[2] = {{fd, POLLIN, 0}, {wake_fd, POLLIN, 0}};
+                if (::poll(fds, 2, -1) < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    // Let read report whatever is wrong with fd
+                    return true;
+                }
+                return fds[1].revents == 0;
+            }
+        }
+
+        void read_into(const std::string& path, std::size_t chunk_size, int wake_fd,
+                       const std::function<bool(std::string&&)>& push) {
+            const bool is_stdin = path == "-";
+            const int fd = is_stdin ? STDIN_FILENO : ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                throw std::runtime_error("Error opening " + path + ": " + std::strerror(errno));
+            }
+#ifdef POSIX_FADV_SEQUENTIAL
+            ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+            for (;;) {
+                AOC2025_TRACE_ZONE("stream/read");
+                std::string chunk(chunk_size, '\0');
+                std::size_t used = 0;
+                bool woken = false;
+                // Fill the whole chunk unless the input ends, pipes return short reads
+                while (used < chunk_size) {
+                    if (!wait_readable(fd, wake_fd)) {
+                        woken = true;
+                        break;
+                    }
+                    const ssize_t count = ::read(fd, chunk.data() + used, chunk_size - used);
+                    if (count < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    if (count < 0) {
+                        const std::string message = "Error reading " + path + ": " + std::strerror(errno);
+                        if (!is_stdin) {
+                            ::close(fd);
+                        }
+                        throw std::runtime_error(message);
+                    }
+                    if (count == 0) {
+                        break;
+                    }
+                    used += static_cast<std::size_t>(count);
+                }
+                chunk.resize(used);
+                if (woken || used == 0 || !push(std::move(chunk)) || used < chunk_size) {
+                    break;
+                }
+            }
+            if (!is_stdin) {
+                ::close(fd);
+            }
+        }
+#else
+        // A blocked istream read cannot be interrupted, so wake_fd goes unused
+        void read_into(const std::string& path, std::size_t chunk_size, int,
+                       const std::function<bool(std::string&&)>& push) {
+            std::ifstream file;
+            std::istream* in = &std::cin;
+            if (path != "-") {
+                file.open(path, std::ios::binary);
+                if (!file.is_open()) {
+                    throw std::runtime_error("Error opening " + path);
+                }
+                in = &file;
+            }
+            for (;;) {
+                std::string chunk(chunk_size, '\0');
+                in->read(chunk.data(), static_cast<std::streamsize>(chunk_size));
+                chunk.resize(static_cast<std::size_t>(in->gcount()));
+                if (chunk.empty() || !push(std::move(chunk)) || !*in) {
+                    break;
+                }
+            }
+        }
+#endif
+
+        // Decompress the raw chunks into chunk_size pieces of text. Returns
+        // false without touching out when raw is closed empty, which is how
+        // the reader says the input was plain and went to out directly.
+        bool decompress_into(ChunkQueue& raw, ChunkQueue& out, std::size_t chunk_size) {
+            std::optional<std::string> chunk = raw.pop();
+            if (!chunk) {
+                return false;
+            }
+            compression::Decoder decoder(compression::detect(*chunk));
+            std::string pending;
+            pending.reserve(chunk_size);
+            bool open = true;
+            const compression::Decoder::Sink sink = [&](std::string_view bytes) {
+                while (open && !bytes.empty()) {
+                    const std::size_t take = std::min(chunk_size - pending.size(), bytes.size());
+                    pending.append(bytes.substr(0, take));
+                    bytes.remove_prefix(take);
+                    if (pending.size() == chunk_size) {
+                        open = out.push(std::move(pending));
+                        pending = std::string();
+                        pending.reserve(chunk_size);
+                    }
+                }
+            };
+            do {
+                AOC2025_TRACE_ZONE("stream/decompress");
+                decoder.feed(*chunk, sink);
+            } while (open && (chunk = raw.pop()));
+            if (!open) {
+                // The consumer stopped, so stop the reader too
+                raw.cancel();
+                return true;
+            }
+            decoder.finish();
+            if (!pending.empty()) {
+                out.push(std::move(pending));
+            }
+            return true;
+        }
+    }
+
+    ChunkReader::ChunkReader(const std::string& path, std::size_t chunk_size, std::size_t depth)
+        : raw_(depth), queue_(depth) {
+        if (chunk_size == 0) {
+            chunk_size = kDefaultChunkSize;
+        }
+#if defined(__unix__) || defined(__APPLE__)
+        if (::pipe(wake_fds_) != 0) {
+            throw std::runtime_error(std::string("Error creating reader wake pipe: ") + std::strerror(errno));
+        }
+#endif
+        reader_ = std::thread([this, path, chunk_size]() {
+            AOC2025_TRACE_THREAD("reader");
+            // The first chunk decides: plain text goes straight to the
+            // consumer, compressed input through the decoder thread
+            ChunkQueue* target = nullptr;
+            std::exception_ptr error;
+            try {
+                read_into(path, chunk_size, wake_fds_[0], [this, &target](std::string&& chunk) {
+                    if (target == nullptr) {
+                        target = compression::detect(chunk) == compression::Format::kNone ? &queue_ : &raw_;
+                    }
+                    return target->push(std::move(chunk));
+                });
+            } catch (...) {
+                error = std::current_exception();
+            }
+            if (target == &raw_) {
+                raw_.close(error);
+            } else {
+                queue_.close(error);
+                raw_.close();
+            }
+        });
+        decoder_ = std::thread([this, chunk_size]() {
+            AOC2025_TRACE_THREAD("decompress");
+            try {
+                if (decompress_into(raw_, queue_, chunk_size)) {
+                    queue_.close();
+                }
+            } catch (...) {
+                queue_.close(std::current_exception());
+            }
+        });
+    }
+
+    ChunkReader::~ChunkReader() {
+        queue_.cancel();
+        raw_.cancel();
+#if defined(__unix__) || defined(__APPLE__)
+        const char byte = 0;
+        [[maybe_unused]] const ssize_t written = ::write(wake_fds_[1], &byte, 1);
+#endif
+        reader_.join();
+        decoder_.join();
+#if defined(__unix__) || defined(__APPLE__)
+        ::close(wake_fds_[0]);
+        ::close(wake_fds_[1]);
+#endif
+    }
+}
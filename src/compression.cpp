@@ -0,0 +1,266 @@
+#include "compression.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+#include "trace.hpp"
+
+#ifdef AOC2025_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef AOC2025_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace aoc2025::compression {
+    namespace {
+        constexpr std::size_t kOutputSize = std::size_t{1} << 18;
+
+        // No format expands data more than this (deflate's limit is about
+        // 1032:1), so a stored length beyond it is corrupt and not reserved
+        constexpr std::size_t kMaxRatio = 1032;
+    }
+
+    std::string_view name(Format format) {
+        switch (format) {
+            case Format::kGzip:
+                return "gzip";
+            case Format::kZstd:
+                return "zstd";
+            case Format::kNone:
+                break;
+        }
+        return "none";
+    }
+
+    bool available(Format format) {
+        switch (format) {
+            case Format::kGzip:
+#ifdef AOC2025_HAVE_ZLIB
+                return true;
+#else
+                return false;
+#endif
+            case Format::kZstd:
+#ifdef AOC2025_HAVE_ZSTD
+                return true;
+#else
+                return false;
+#endif
+            case Format::kNone:
+                break;
+        }
+        return true;
+    }
+
+    struct Decoder::State {
+        Format format;
+        std::string output = std::string(kOutputSize, '\0');
+#ifdef AOC2025_HAVE_ZLIB
+        z_stream zlib {};
+        // Inside a gzip member; false between members
+        bool in_member = true;
+#endif
+#ifdef AOC2025_HAVE_ZSTD
+        ZSTD_DCtx* zstd = nullptr;
+        // Nonzero while a frame is incomplete
+        std::size_t zstd_pending = 0;
+#endif
+
+        explicit State(Format data_format) : format(data_format) {
+            switch (format) {
+                case Format::kGzip:
+#ifdef AOC2025_HAVE_ZLIB
+                    // 16 + window bits: gzip wrapper only, not raw zlib streams
+                    if (inflateInit2(&zlib, 16 + MAX_WBITS) != Z_OK) {
+                        throw std::runtime_error("Error initialising gzip decoder");
+                    }
+                    return;
+#else
+                    break;
+#endif
+                case Format::kZstd:
+#ifdef AOC2025_HAVE_ZSTD
+                    zstd = ZSTD_createDCtx();
+                    if (zstd == nullptr) {
+                        throw std::runtime_error("Error initialising zstd decoder");
+                    }
+                    return;
+#else
+                    break;
+#endif
+                case Format::kNone:
+                    return;
+            }
+            throw std::runtime_error("This build cannot read " + std::string(name(format)) +
+                                     " input, reconfigure with its library installed");
+        }
+
+        ~State() {
+#ifdef AOC2025_HAVE_ZLIB
+            if (format == Format::kGzip) {
+                inflateEnd(&zlib);
+            }
+#endif
+#ifdef AOC2025_HAVE_ZSTD
+            ZSTD_freeDCtx(zstd);
+#endif
+        }
+
+        State(const State&) = delete;
+        State& operator=(const State&) = delete;
+    };
+
+    Decoder::Decoder(Format format) : state_(std::make_unique<State>(format)) {}
+
+    Decoder::~Decoder() = default;
+
+    void Decoder::feed(std::string_view compressed, const Sink& sink) {
+        State& state = *state_;
+        std::string& output = state.output;
+        switch (state.format) {
+            case Format::kNone:
+                sink(compressed);
+                return;
+            case Format::kGzip: {
+#ifdef AOC2025_HAVE_ZLIB
+                z_stream& zlib = state.zlib;
+                zlib.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(compressed.data()));
+                zlib.avail_in = 0;
+                // zlib counts input in uInt, so 4 GiB and up goes in as slices
+                std::size_t unfed = compressed.size();
+                for (;;) {
+                    if (zlib.avail_in == 0 && unfed > 0) {
+                        const std::size_t slice = std::min<std::size_t>(unfed, std::numeric_limits<uInt>::max());
+                        zlib.avail_in = static_cast<uInt>(slice);
+                        unfed -= slice;
+                    }
+                    if (!state.in_member) {
+                        if (zlib.avail_in == 0) {
+                            break;
+                        }
+                        inflateReset(&zlib);
+                        state.in_member = true;
+                    }
+                    zlib.next_out = reinterpret_cast<Bytef*>(output.data());
+                    zlib.avail_out = static_cast<uInt>(output.size());
+                    const int result = inflate(&zlib, Z_NO_FLUSH);
+                    if (result != Z_OK && result != Z_STREAM_END && result != Z_BUF_ERROR) {
+                        throw std::runtime_error(std::string("Corrupt gzip data: ") +
+                                                 (zlib.msg != nullptr ? zlib.msg : "inflate failed"));
+                    }
+                    const std::size_t produced = output.size() - zlib.avail_out;
+                    if (produced > 0) {
+                        sink(std::string_view(output.data(), produced));
+                    }
+                    if (result == Z_STREAM_END) {
+                        state.in_member = false;
+                        continue;
+                    }
+                    // Output space left means all the slice was taken
+                    if (zlib.avail_out != 0 && unfed == 0) {
+                        break;
+                    }
+                }
+#endif
+                return;
+            }
+            case Format::kZstd: {
+#ifdef AOC2025_HAVE_ZSTD
+                ZSTD_inBuffer in{compressed.data(), compressed.size(), 0};
+                for (;;) {
+                    ZSTD_outBuffer out{output.data(), output.size(), 0};
+                    const std::size_t result = ZSTD_decompressStream(state.zstd, &out, &in);
+                    if (ZSTD_isError(result)) {
+                        throw std::runtime_error(std::string("Corrupt zstd data: ") + ZSTD_getErrorName(result));
+                    }
+                    state.zstd_pending = result;
+                    if (out.pos > 0) {
+                        sink(std::string_view(output.data(), out.pos));
+                    }
+                    if (in.pos == in.size && out.pos < out.size) {
+                        break;
+                    }
+                }
+#endif
+                return;
+            }
+        }
+    }
+
+    void Decoder::finish() {
+#ifdef AOC2025_HAVE_ZLIB
+        if (state_->format == Format::kGzip && state_->in_member) {
+            throw std::runtime_error("Truncated gzip data");
+        }
+#endif
+#ifdef AOC2025_HAVE_ZSTD
+        if (state_->format == Format::kZstd && state_->zstd_pending != 0) {
+            throw std::runtime_error("Truncated zstd data");
+        }
+#endif
+    }
+
+    std::optional<std::uint64_t> stored_size(Format format, std::string_view head, std::string_view tail) {
+        // gzip ends with the input length modulo 2^32, zstd frames may start with it
+        if (format == Format::kGzip && head.size() >= 10 && tail.size() >= 8) {
+            std::uint64_t size = 0;
+            for (std::size_t i = 0; i < 4; ++i) {
+                size |= std::uint64_t{static_cast<unsigned char>(tail[tail.size() - 4 + i])} << (8 * i);
+            }
+            return size;
+        }
+#ifdef AOC2025_HAVE_ZSTD
+        if (format == Format::kZstd) {
+            const unsigned long long size = ZSTD_getFrameContentSize(head.data(), head.size());
+            if (size != ZSTD_CONTENTSIZE_UNKNOWN && size != ZSTD_CONTENTSIZE_ERROR) {
+                return size;
+            }
+        }
+#endif
+        return std::nullopt;
+    }
+
+    std::uint64_t expanded_size(const std::filesystem::path& path) {
+        std::error_code error;
+        const std::uint64_t size = std::filesystem::file_size(path, error);
+        if (error) {
+            return 0;
+        }
+        std::ifstream file(path, std::ios::binary);
+        // Enough for any zstd frame header
+        std::string head(18, '\0');
+        file.read(head.data(), static_cast<std::streamsize>(head.size()));
+        head.resize(static_cast<std::size_t>(std::max<std::streamsize>(file.gcount(), 0)));
+        const Format format = detect(head);
+        if (format == Format::kNone) {
+            return size;
+        }
+        std::string tail(std::min<std::uint64_t>(size, 8), '\0');
+        file.clear();
+        file.seekg(-static_cast<std::streamoff>(tail.size()), std::ios::end);
+        file.read(tail.data(), static_cast<std::streamsize>(tail.size()));
+        if (!file) {
+            return size;
+        }
+        // A stored length below the file size has wrapped past 4 GiB
+        return std::max(stored_size(format, head, tail).value_or(size), size);
+    }
+
+    std::string decompress(Format format, std::string_view compressed) {
+        AOC2025_TRACE_ZONE("input/decompress");
+        if (format == Format::kNone) {
+            return std::string(compressed);
+        }
+        const std::uint64_t expected = stored_size(format, compressed, compressed).value_or(0);
+        std::string result;
+        result.reserve(static_cast<std::size_t>(std::min<std::uint64_t>(expected, compressed.size() * kMaxRatio)));
+        Decoder decoder(format);
+        decoder.feed(compressed, [&result](std::string_view bytes) { result.append(bytes); });
+        decoder.finish();
+        AOC2025_TRACE_COUNTER("decompressed_bytes", result.size());
+        return result;
+    }
+}
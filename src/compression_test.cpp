@@ -0,0 +1,213 @@
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include "chunk_reader.hpp"
+#include "compression.hpp"
+#include "generator.hpp"
+#include "input.hpp"
+
+#ifdef AOC2025_HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef AOC2025_HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+namespace compression_tests {
+
+static std::string sample_text() {
+    aoc2025::gen::Options options;
+    options.bytes = 300 << 10;
+    return aoc2025::gen::generate(3, options);
+}
+
+static std::filesystem::path write_temp(const std::string& name, const std::string& contents) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream file(path, std::ios::binary);
+    file << contents;
+    return path;
+}
+
+static std::string decode_in_pieces(aoc2025::compression::Format format, std::string_view data, std::size_t piece) {
+    std::string text;
+    aoc2025::compression::Decoder decoder(format);
+    for (std::size_t at = 0; at < data.size(); at += piece) {
+        decoder.feed(data.substr(at, piece), [&text](std::string_view bytes) { text.append(bytes); });
+    }
+    decoder.finish();
+    return text;
+}
+
+TEST_CASE("Compression: detect - Magic Bytes", "[compression][component]") {
+    // Assert
+    STATIC_REQUIRE(aoc2025::compression::detect("\x1f\x8b\x08") == aoc2025::compression::Format::kGzip);
+    STATIC_REQUIRE(aoc2025::compression::detect("\x28\xb5\x2f\xfd\x04") == aoc2025::compression::Format::kZstd);
+    STATIC_REQUIRE(aoc2025::compression::detect("\x28\xb5\x2f") == aoc2025::compression::Format::kNone);
+    STATIC_REQUIRE(aoc2025::compression::detect("L68\nR12") == aoc2025::compression::Format::kNone);
+    STATIC_REQUIRE(aoc2025::compression::detect("") == aoc2025::compression::Format::kNone);
+    REQUIRE(aoc2025::compression::name(aoc2025::compression::Format::kZstd) == "zstd");
+    REQUIRE(aoc2025::compression::available(aoc2025::compression::Format::kNone));
+}
+
+TEST_CASE("Compression: Decoder - Plain Text Passes Through", "[compression][component]") {
+    // Act
+    const std::string text = decode_in_pieces(aoc2025::compression::Format::kNone, "11-22,95-115", 5);
+
+    // Assert
+    REQUIRE(text == "11-22,95-115");
+    REQUIRE(aoc2025::compression::decompress(aoc2025::compression::Format::kNone, "abc") == "abc");
+}
+
+TEST_CASE("Compression: Decoder - Missing Library Is An Error", "[compression][component]") {
+    for (const auto format : {aoc2025::compression::Format::kGzip, aoc2025::compression::Format::kZstd}) {
+        if (!aoc2025::compression::available(format)) {
+            // Act & Assert
+            REQUIRE_THROWS_AS(aoc2025::compression::Decoder(format), std::runtime_error);
+        }
+    }
+}
+
+#ifdef AOC2025_HAVE_ZLIB
+static std::string gzip(std::string_view text) {
+    z_stream stream {};
+    REQUIRE(deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+    std::string out(deflateBound(&stream, static_cast<uLong>(text.size())) + 64, '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(text.data()));
+    stream.avail_in = static_cast<uInt>(text.size());
+    stream.next_out = reinterpret_cast<Bytef*>(out.data());
+    stream.avail_out = static_cast<uInt>(out.size());
+    REQUIRE(deflate(&stream, Z_FINISH) == Z_STREAM_END);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return out;
+}
+
+TEST_CASE("Compression: gzip - Whole And Piecewise", "[compression][component]") {
+    // Arrange
+    const std::string text = sample_text();
+    const std::string compressed = gzip(text);
+
+    // Act & Assert
+    REQUIRE(aoc2025::compression::detect(compressed) == aoc2025::compression::Format::kGzip);
+    REQUIRE(aoc2025::compression::decompress(aoc2025::compression::Format::kGzip, compressed) == text);
+    REQUIRE(decode_in_pieces(aoc2025::compression::Format::kGzip, compressed, 1) == text);
+    REQUIRE(decode_in_pieces(aoc2025::compression::Format::kGzip, compressed, 4093) == text);
+}
+
+TEST_CASE("Compression: gzip - Concatenated Members", "[compression][component]") {
+    // Arrange
+    const std::string compressed = gzip("987654321111111\n") + gzip("123456789\n");
+
+    // Act & Assert
+    REQUIRE(aoc2025::compression::decompress(aoc2025::compression::Format::kGzip, compressed) ==
+            "987654321111111\n123456789\n");
+    REQUIRE(decode_in_pieces(aoc2025::compression::Format::kGzip, compressed, 3) == "987654321111111\n123456789\n");
+}
+
+TEST_CASE("Compression: gzip - Truncated And Corrupt Data", "[compression][component]") {
+    // Arrange
+    const std::string compressed = gzip(sample_text());
+    std::string corrupt = compressed;
+    corrupt[corrupt.size() / 2] = static_cast<char>(corrupt[corrupt.size() / 2] ^ 0x55);
+
+    // Act & Assert
+    REQUIRE_THROWS_AS(aoc2025::compression::decompress(aoc2025::compression::Format::kGzip,
+                                                       std::string_view(compressed).substr(0, compressed.size() / 2)),
+                      std::runtime_error);
+    REQUIRE_THROWS_AS(aoc2025::compression::decompress(aoc2025::compression::Format::kGzip, corrupt), std::runtime_error);
+}
+
+TEST_CASE("Compression: Input - Opens gzip Files As Text", "[compression][integration]") {
+    // Arrange
+    const std::string text = sample_text();
+    const auto path = write_temp("aoc2025_compression_input.txt.gz", gzip(text));
+
+    // Act
+    const aoc2025::Input input = aoc2025::Input::open(path.string());
+
+    // Assert
+    REQUIRE(input.view() == text);
+    REQUIRE_FALSE(input.is_mapped());
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Compression: expanded_size - Stored Length Of gzip Files", "[compression][integration]") {
+    // Arrange
+    const std::string text = sample_text();
+    const std::string compressed = gzip(text);
+    const auto gzip_path = write_temp("aoc2025_compression_size.txt.gz", compressed);
+    const auto plain_path = write_temp("aoc2025_compression_size.txt", text);
+
+    // Act & Assert
+    REQUIRE(aoc2025::compression::stored_size(aoc2025::compression::Format::kGzip, compressed, compressed) == text.size());
+    REQUIRE_FALSE(aoc2025::compression::stored_size(aoc2025::compression::Format::kNone, text, text).has_value());
+    REQUIRE(aoc2025::compression::expanded_size(gzip_path) == text.size());
+    REQUIRE(aoc2025::compression::expanded_size(plain_path) == text.size());
+    REQUIRE(aoc2025::compression::expanded_size(gzip_path.string() + ".missing") == 0);
+    std::filesystem::remove(gzip_path);
+    std::filesystem::remove(plain_path);
+}
+
+TEST_CASE("Compression: ChunkReader - Streams gzip Files As Text", "[compression][integration]") {
+    // Arrange
+    const std::string text = sample_text();
+    const auto path = write_temp("aoc2025_compression_stream.txt.gz", gzip(text));
+
+    // Act
+    std::string joined;
+    std::size_t chunks = 0;
+    {
+        aoc2025::ChunkReader reader(path.string(), 4096, 2);
+        while (auto chunk = reader.next()) {
+            REQUIRE(chunk->size() <= 4096);
+            joined += *chunk;
+            ++chunks;
+        }
+    }
+
+    // Assert
+    REQUIRE(joined == text);
+    REQUIRE(chunks == (text.size() + 4095) / 4096);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Compression: ChunkReader - Early Exit And Errors", "[compression][integration]") {
+    // Arrange
+    const std::string compressed = gzip(sample_text());
+    const auto path = write_temp("aoc2025_compression_early.txt.gz", compressed);
+    const auto truncated = write_temp("aoc2025_compression_truncated.txt.gz", compressed.substr(0, compressed.size() - 10));
+
+    // Act & Assert
+    {
+        aoc2025::ChunkReader reader(path.string(), 64, 1);
+        REQUIRE(reader.next().has_value());
+    }
+    aoc2025::ChunkReader reader(truncated.string(), 1 << 16, 2);
+    REQUIRE_THROWS_AS([&reader]() { while (reader.next()) {} }(), std::runtime_error);
+    std::filesystem::remove(path);
+    std::filesystem::remove(truncated);
+}
+#endif
+
+#ifdef AOC2025_HAVE_ZSTD
+TEST_CASE("Compression: zstd - Whole, Piecewise And Truncated", "[compression][component]") {
+    // Arrange
+    const std::string text = sample_text();
+    std::string compressed(ZSTD_compressBound(text.size()), '\0');
+    compressed.resize(ZSTD_compress(compressed.data(), compressed.size(), text.data(), text.size(), 1));
+
+    // Act & Assert
+    REQUIRE(aoc2025::compression::detect(compressed) == aoc2025::compression::Format::kZstd);
+    REQUIRE(aoc2025::compression::decompress(aoc2025::compression::Format::kZstd, compressed) == text);
+    REQUIRE(decode_in_pieces(aoc2025::compression::Format::kZstd, compressed, 777) == text);
+    REQUIRE(aoc2025::compression::stored_size(aoc2025::compression::Format::kZstd, compressed, compressed) == text.size());
+    REQUIRE(decode_in_pieces(aoc2025::compression::Format::kZstd, compressed + compressed, 4096) == text + text);
+    REQUIRE_THROWS_AS(decode_in_pieces(aoc2025::compression::Format::kZstd,
+                                       std::string_view(compressed).substr(0, compressed.size() - 8), 4096),
+                      std::runtime_error);
+}
+#endif
+
+} // namespace compression_tests
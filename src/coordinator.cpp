@@ -0,0 +1,398 @@
+#include "coordinator.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <iomanip>
+#include <optional>
+#include <stdexcept>
+
+#include "compression.hpp"
+#include "server.hpp"
+#include "trace.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define AOC2025_HAVE_FORK 1
+#endif
+
+namespace aoc2025 {
+    std::vector<std::string_view> split_shards(std::string_view input, char delimiter, std::size_t count) {
+        std::vector<std::string_view> shards;
+        const std::size_t target = (input.size() + std::max<std::size_t>(count, 1) - 1) / std::max<std::size_t>(count, 1);
+        std::size_t begin = 0;
+        while (begin < input.size()) {
+            std::size_t end = std::min(begin + target, input.size());
+            if (end < input.size()) {
+                // Extend to the end of the record the cut falls in
+                const std::size_t at = input.find(delimiter, end - 1);
+                end = at == std::string_view::npos ? input.size() : at + 1;
+            }
+            shards.push_back(input.substr(begin, end - begin));
+            begin = end;
+        }
+        return shards;
+    }
+
+    struct Coordinator::Worker {
+        std::string endpoint;  // empty for a forked worker
+        int fd = -1;           // -1 once an endpoint can no longer be reached
+        int pid = -1;
+        std::optional<std::size_t> shard;
+        std::chrono::steady_clock::time_point deadline;
+        protocol::FrameDecoder decoder;
+    };
+
+#ifdef AOC2025_HAVE_FORK
+    namespace {
+        double elapsed_ms(std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+
+        // Milliseconds until the first deadline, rounded up, for poll
+        int poll_timeout(std::chrono::steady_clock::time_point first) {
+            const auto left = std::chrono::ceil<std::chrono::milliseconds>(first - std::chrono::steady_clock::now());
+            return static_cast<int>(std::clamp<std::chrono::milliseconds::rep>(left.count(), 0, 1 << 30));
+        }
+    }
+
+    Coordinator::Coordinator(ShardOptions options) : options_(std::move(options)) {
+        const std::size_t count = options_.endpoints.empty() ? std::max(1u, options_.workers) : options_.endpoints.size();
+        for (std::size_t i = 0; i < count; ++i) {
+            auto worker = std::make_unique<Worker>();
+            if (!options_.endpoints.empty()) {
+                worker->endpoint = options_.endpoints[i];
+            }
+            workers_.push_back(std::move(worker));
+        }
+        for (auto& worker : workers_) {
+            start(*worker);
+        }
+    }
+
+    Coordinator::~Coordinator() {
+        // Closing the sockets lets every forked worker finish, then reap them all
+        for (auto& worker : workers_) {
+            if (worker->fd >= 0) {
+                ::close(worker->fd);
+            }
+        }
+        for (auto& worker : workers_) {
+            if (worker->pid > 0) {
+                ::waitpid(worker->pid, nullptr, 0);
+            }
+        }
+    }
+
+    // Fork a worker serving the far end of a socket pair, or connect to an
+    // endpoint; an endpoint that cannot be reached leaves the worker unused
+    void Coordinator::start(Worker& worker) {
+        worker.shard.reset();
+        worker.decoder = protocol::FrameDecoder();
+        if (!worker.endpoint.empty()) {
+            try {
+                worker.fd = connect_socket(worker.endpoint);
+            } catch (const std::runtime_error&) {
+                worker.fd = -1;
+            }
+            return;
+        }
+        int fds[2];
+        if (::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0) {
+            throw std::runtime_error(std::string("Error creating worker socket: ") + std::strerror(errno));
+        }
+        const pid_t pid = ::fork();
+        if (pid < 0) {
+            ::close(fds[0]);
+            ::close(fds[1]);
+            throw std::runtime_error(std::string("Error forking worker: ") + std::strerror(errno));
+        }
+        if (pid == 0) {
+            // Hold no other worker's socket open, so a coordinator always sees
+            // a hang-up when the worker on the far end dies
+            for (const auto& other : workers_) {
+                if (other->fd >= 0) {
+                    ::close(other->fd);
+                }
+            }
+            ::close(fds[0]);
+            serve_socket(fds[1]);
+            ::_exit(0);
+        }
+        ::close(fds[1]);
+        ::fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+        worker.fd = fds[0];
+        worker.pid = pid;
+    }
+
+    void Coordinator::stop(Worker& worker) {
+        if (worker.fd >= 0) {
+            ::close(worker.fd);
+            worker.fd = -1;
+        }
+        if (worker.pid > 0) {
+            // It may be alive but stuck, so do not wait for it to notice
+            ::kill(worker.pid, SIGKILL);
+            ::waitpid(worker.pid, nullptr, 0);
+            worker.pid = -1;
+        }
+    }
+
+    std::vector<int> Coordinator::worker_pids() const {
+        std::vector<int> pids;
+        for (const auto& worker : workers_) {
+            pids.push_back(worker->pid);
+        }
+        return pids;
+    }
+
+    Answer Coordinator::solve(const Day& day, int part, std::string_view input) {
+        if (!day.is_shardable()) {
+            throw std::invalid_argument("Day " + std::to_string(day.day_number) + " cannot be sharded");
+        }
+        // Shards travel inside frames, so a large input is cut finer; half the
+        // limit leaves room for the record each cut is extended to
+        const std::size_t count = std::max(workers_.size() * options_.shards_per_worker,
+                                           input.size() / (protocol::kMaxFrameSize / 2) + 1);
+        const auto shards = split_shards(input, day.shard_delimiter, count);
+        std::vector<protocol::Request> requests;
+        for (const std::string_view shard : shards) {
+            requests.push_back({0, protocol::Kind::kSolve, static_cast<std::uint8_t>(day.day_number),
+                                static_cast<std::uint8_t>(part), std::string(shard)});
+        }
+        return dispatch(std::move(requests));
+    }
+
+    Answer Coordinator::solve_file(const Day& day, int part, const std::filesystem::path& path) {
+        if (!day.is_shardable()) {
+            throw std::invalid_argument("Day " + std::to_string(day.day_number) + " cannot be sharded");
+        }
+        // Workers may run elsewhere, so name the file independently of our directory
+        const std::string absolute = std::filesystem::absolute(path).string();
+        const Input input = Input::open_raw(absolute);
+        const compression::Format format = compression::detect(input.view());
+        if (format != compression::Format::kNone) {
+            // Workers would each inflate the whole file for their slice, so
+            // inflate it once here and send the shards themselves
+            return solve(day, part, compression::decompress(format, input.view()));
+        }
+        const auto shards = split_shards(input.view(), day.shard_delimiter, workers_.size() * options_.shards_per_worker);
+        std::vector<protocol::Request> requests;
+        for (const std::string_view shard : shards) {
+            const protocol::Slice slice{static_cast<std::uint64_t>(shard.data() - input.view().data()), shard.size(), absolute};
+            requests.push_back({0, protocol::Kind::kSolveSlice, static_cast<std::uint8_t>(day.day_number),
+                                static_cast<std::uint8_t>(part), protocol::encode(slice)});
+        }
+        return dispatch(std::move(requests));
+    }
+
+    // Keep every live worker busy with one shard until all are answered
+    Answer Coordinator::dispatch(std::vector<protocol::Request> requests) {
+        AOC2025_TRACE_ZONE("coordinator/dispatch", static_cast<std::int64_t>(requests.size()));
+        std::deque<std::size_t> pending;
+        for (std::size_t i = 0; i < requests.size(); ++i) {
+            requests[i].id = static_cast<std::uint32_t>(i);
+            pending.push_back(i);
+        }
+        stats_.shards += requests.size();
+        std::vector<int> attempts(requests.size(), 0);
+        std::vector<std::optional<Answer>> answers(requests.size());
+        std::size_t remaining = requests.size();
+
+        // Hand the worker's shard out again and replace the worker
+        auto fail = [&](Worker& worker) {
+            const std::size_t shard = *worker.shard;
+            if (attempts[shard] >= options_.max_attempts) {
+                throw std::runtime_error("Shard " + std::to_string(shard) + " failed on " +
+                                         std::to_string(attempts[shard]) + " workers");
+            }
+            pending.push_front(shard);
+            ++stats_.retries;
+            stop(worker);
+            start(worker);
+            if (worker.fd >= 0) {
+                ++stats_.restarts;
+            }
+        };
+
+        std::string buffer(std::size_t{1} << 16, '\0');
+        try {
+            while (remaining > 0) {
+                for (auto& worker : workers_) {
+                    if (worker->fd < 0 || worker->shard || pending.empty()) {
+                        continue;
+                    }
+                    worker->shard = pending.front();
+                    worker->deadline = std::chrono::steady_clock::now() + options_.shard_timeout;
+                    pending.pop_front();
+                    ++attempts[*worker->shard];
+                    if (!write_all(worker->fd, protocol::encode(requests[*worker->shard]))) {
+                        fail(*worker);
+                    }
+                }
+
+                std::vector<pollfd> fds;
+                std::vector<Worker*> busy;
+                std::optional<std::chrono::steady_clock::time_point> first_deadline;
+                for (auto& worker : workers_) {
+                    if (worker->fd >= 0 && worker->shard) {
+                        fds.push_back({worker->fd, POLLIN, 0});
+                        busy.push_back(worker.get());
+                        if (options_.shard_timeout.count() > 0) {
+                            first_deadline = std::min(first_deadline.value_or(worker->deadline), worker->deadline);
+                        }
+                    }
+                }
+                if (busy.empty()) {
+                    if (std::none_of(workers_.begin(), workers_.end(), [](const auto& w) { return w->fd >= 0; })) {
+                        throw std::runtime_error("No shard workers left");
+                    }
+                    continue;
+                }
+                if (::poll(fds.data(), fds.size(), first_deadline ? poll_timeout(*first_deadline) : -1) < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    throw std::runtime_error(std::string("Error polling workers: ") + std::strerror(errno));
+                }
+
+                const auto now = std::chrono::steady_clock::now();
+                for (std::size_t i = 0; i < busy.size(); ++i) {
+                    Worker& worker = *busy[i];
+                    if (fds[i].revents == 0) {
+                        // A worker stuck on its shard is treated like one that died
+                        if (first_deadline && now >= worker.deadline) {
+                            fail(worker);
+                        }
+                        continue;
+                    }
+                    const ssize_t count = ::read(worker.fd, buffer.data(), buffer.size());
+                    if (count < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    if (count <= 0) {
+                        fail(worker);
+                        continue;
+                    }
+                    worker.decoder.feed(std::string_view(buffer.data(), static_cast<std::size_t>(count)));
+                    if (const auto payload = worker.decoder.next()) {
+                        const protocol::Response response = protocol::decode_response(*payload);
+                        if (response.status != protocol::Status::kOk) {
+                            throw std::runtime_error(response.text);
+                        }
+                        if (response.id != *worker.shard) {
+                            throw std::runtime_error("Worker answered shard " + std::to_string(response.id) +
+                                                     " while solving " + std::to_string(*worker.shard));
+                        }
+                        answers[*worker.shard] = Answer::parse(response.text);
+                        worker.shard.reset();
+                        --remaining;
+                    }
+                }
+            }
+        } catch (...) {
+            // Answers still in flight would be read as the next solve's, so
+            // replace the workers that owe one
+            for (auto& worker : workers_) {
+                if (worker->shard) {
+                    stop(*worker);
+                    try {
+                        start(*worker);
+                    } catch (const std::exception&) {
+                        // Leave it unused; the next solve reports if none are left
+                    }
+                }
+            }
+            throw;
+        }
+
+        Answer total(0);
+        for (const auto& answer : answers) {
+            total += *answer;
+        }
+        return total;
+    }
+
+    int run_sharded(const RunOptions& options, const std::string& path, const ShardOptions& shard,
+                    std::ostream& out, std::ostream& err) {
+        if (options.days.size() != 1) {
+            err << "--shard needs exactly one day\n";
+            return 1;
+        }
+        const int day_number = options.days.front();
+        const auto it = days.find(day_number);
+        if (it == days.end()) {
+            err << "Day " << day_number << " not implemented yet\n";
+            return 1;
+        }
+        const Day& day = it->second;
+        if (!day.is_shardable()) {
+            err << "Day " << day_number << " cannot be sharded\n";
+            return 1;
+        }
+
+        try {
+            Coordinator coordinator(shard);
+            // Inflated once for both parts rather than by solve_file per part
+            const Input raw = Input::open_raw(path);
+            const compression::Format format = compression::detect(raw.view());
+            const std::string text = format == compression::Format::kNone ? std::string()
+                                                                          : compression::decompress(format, raw.view());
+            out << "Day " << day_number << ":\n";
+            for (int part = 1; part <= 2; ++part) {
+                if (!day.has_part(part)) {
+                    out << "  Part " << part << ": Not yet unlocked\n";
+                    continue;
+                }
+                const auto start = std::chrono::steady_clock::now();
+                try {
+                    const Answer answer = format == compression::Format::kNone
+                        ? coordinator.solve_file(day, part, path)
+                        : coordinator.solve(day, part, text);
+                    out << "  Part " << part << ": " << answer << '\n';
+                } catch (const std::exception& error) {
+                    out << "  Part " << part << ": failed\n";
+                    err << "Day " << day_number << " part " << part << ": " << error.what() << '\n';
+                }
+                if (options.show_timings) {
+                    out << "  Sharded: " << std::fixed << std::setprecision(3) << elapsed_ms(start) << " ms\n";
+                }
+            }
+            if (options.show_timings) {
+                const ShardStats& stats = coordinator.stats();
+                out << "  Shards: " << stats.shards << " over " << coordinator.worker_pids().size() << " workers, "
+                    << stats.retries << " retried, " << stats.restarts << " workers restarted\n";
+            }
+            out << '\n';
+            return 0;
+        } catch (const std::exception& error) {
+            err << error.what() << '\n';
+            return 1;
+        }
+    }
+#else
+    Coordinator::Coordinator(ShardOptions options) : options_(std::move(options)) {
+        throw std::runtime_error("Sharding needs fork and Unix domain sockets, which this platform lacks");
+    }
+
+    Coordinator::~Coordinator() = default;
+    void Coordinator::start(Worker&) {}
+    void Coordinator::stop(Worker&) {}
+    std::vector<int> Coordinator::worker_pids() const { return {}; }
+    Answer Coordinator::solve(const Day&, int, std::string_view) { return {}; }
+    Answer Coordinator::solve_file(const Day&, int, const std::filesystem::path&) { return {}; }
+    Answer Coordinator::dispatch(std::vector<protocol::Request>) { return {}; }
+
+    int run_sharded(const RunOptions&, const std::string&, const ShardOptions&, std::ostream&, std::ostream& err) {
+        err << "--shard needs fork and Unix domain sockets, which this platform lacks\n";
+        return 1;
+    }
+#endif
+}
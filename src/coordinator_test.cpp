@@ -0,0 +1,239 @@
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include "aoc2025.hpp"
+#include "coordinator.hpp"
+#include "day1.hpp"
+#include "day2.hpp"
+#include "day3.hpp"
+#include "generator.hpp"
+#include "server.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#ifdef AOC2025_HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace coordinator_tests {
+
+static std::string generated(int day_number) {
+    aoc2025::gen::Options options;
+    options.bytes = 64 << 10;
+    return aoc2025::gen::generate(day_number, options);
+}
+
+// Forked workers solve from the registry they inherit
+static void register_days() {
+    aoc2025::register_day(Day1::Day1);
+    aoc2025::register_day(Day2::Day2);
+    aoc2025::register_day(Day3::Day3);
+}
+
+TEST_CASE("Coordinator: split_shards - Cuts After Delimiters Only", "[coordinator][component]") {
+    // Arrange
+    const std::string input = generated(3);
+
+    // Act
+    const auto shards = aoc2025::split_shards(input, '\n', 7);
+
+    // Assert
+    REQUIRE(shards.size() <= 7);
+    REQUIRE(shards.size() >= 6);
+    std::string joined;
+    for (std::size_t i = 0; i < shards.size(); ++i) {
+        REQUIRE_FALSE(shards[i].empty());
+        if (i + 1 < shards.size()) {
+            REQUIRE(shards[i].back() == '\n');
+        }
+        joined += shards[i];
+    }
+    REQUIRE(joined == input);
+}
+
+TEST_CASE("Coordinator: split_shards - Edge Cases", "[coordinator][component]") {
+    // Assert
+    REQUIRE(aoc2025::split_shards("", ',', 4).empty());
+    REQUIRE(aoc2025::split_shards("11-22", ',', 4) == std::vector<std::string_view>{"11-22"});
+    REQUIRE(aoc2025::split_shards("1-2,3-4", ',', 0) == std::vector<std::string_view>{"1-2,3-4"});
+    REQUIRE(aoc2025::split_shards("1-2,3-4,5-6", ',', 100) == std::vector<std::string_view>{"1-2,", "3-4,", "5-6"});
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_CASE("Coordinator: Solve - Matches Single Process", "[coordinator][integration]") {
+    // Arrange
+    register_days();
+    const std::string day2 = generated(2);
+    const std::string day3 = generated(3);
+    aoc2025::Coordinator coordinator({3, {}, 4, 3});
+
+    // Act & Assert
+    for (int part = 1; part <= 2; ++part) {
+        REQUIRE(coordinator.solve(Day2::Day2, part, day2) == Day2::Day2.solve(part, day2));
+        REQUIRE(coordinator.solve(Day3::Day3, part, day3) == Day3::Day3.solve(part, day3));
+    }
+    REQUIRE(coordinator.stats().shards >= 4 * 12 - 4);
+    REQUIRE(coordinator.stats().restarts == 0);
+}
+
+TEST_CASE("Coordinator: Solve File - Byte Ranges Of The Input", "[coordinator][integration]") {
+    // Arrange
+    register_days();
+    const auto path = std::filesystem::temp_directory_path() / "aoc2025_coordinator_day3.txt";
+    const std::string input = generated(3);
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << input;
+    }
+    aoc2025::Coordinator coordinator({2, {}, 4, 3});
+
+    // Act
+    const aoc2025::Answer part1 = coordinator.solve_file(Day3::Day3, 1, path);
+    const aoc2025::Answer part2 = coordinator.solve_file(Day3::Day3, 2, path);
+
+    // Assert
+    REQUIRE(part1 == Day3::Day3.solve(1, input));
+    REQUIRE(part2 == Day3::Day3.solve(2, input));
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Coordinator: Solve - Restarts Killed Workers", "[coordinator][integration]") {
+    // Arrange
+    register_days();
+    const std::string input = generated(2);
+    aoc2025::Coordinator coordinator({2, {}, 4, 3});
+    for (const int pid : coordinator.worker_pids()) {
+        ::kill(pid, SIGKILL);
+    }
+
+    // Act
+    const aoc2025::Answer answer = coordinator.solve(Day2::Day2, 2, input);
+
+    // Assert
+    REQUIRE(answer == Day2::Day2.solve(2, input));
+    REQUIRE(coordinator.stats().restarts == 2);
+    REQUIRE(coordinator.stats().retries == 2);
+}
+
+TEST_CASE("Coordinator: Solve - Worker Errors Fail The Solve", "[coordinator][integration]") {
+    // Arrange
+    register_days();
+    aoc2025::Coordinator coordinator({2, {}, 4, 3});
+
+    // Act & Assert
+    REQUIRE_THROWS_AS(coordinator.solve(Day2::Day2, 1, "11-22,95-115,oops-1,998-1012"), std::runtime_error);
+    REQUIRE_THROWS_AS(coordinator.solve(Day1::Day1, 1, "L68\nL30"), std::invalid_argument);
+    // Still usable afterwards
+    REQUIRE(coordinator.solve(Day2::Day2, 1, "11-22,95-115,998-1012") == aoc2025::Answer(11 + 22 + 99 + 1010));
+}
+
+TEST_CASE("Coordinator: Solve - Daemon Endpoints", "[coordinator][integration]") {
+    // Arrange
+    register_days();
+    const auto socket_path = std::filesystem::temp_directory_path() / "aoc2025_coordinator_test.sock";
+    aoc2025::Server server({socket_path.string(), 2});
+    std::thread accept_loop([&server]() { server.run(); });
+    const std::string input = generated(3);
+
+    // Act
+    aoc2025::Answer answer;
+    {
+        aoc2025::Coordinator coordinator({0, {socket_path.string(), socket_path.string()}, 4, 3});
+        answer = coordinator.solve(Day3::Day3, 2, input);
+        REQUIRE(coordinator.worker_pids() == std::vector<int>{-1, -1});
+    }
+    server.stop();
+    accept_loop.join();
+
+    // Assert
+    REQUIRE(answer == Day3::Day3.solve(2, input));
+}
+
+TEST_CASE("Coordinator: Solve - Stalled Worker Times Out", "[coordinator][integration]") {
+    // Arrange: a daemon that accepts connections into its backlog but never
+    // reads or answers, next to a working one
+    register_days();
+    const auto stalled_path = std::filesystem::temp_directory_path() / "aoc2025_coordinator_stalled.sock";
+    const auto socket_path = std::filesystem::temp_directory_path() / "aoc2025_coordinator_live.sock";
+    std::filesystem::remove(stalled_path);
+    const int stalled = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, stalled_path.c_str(), sizeof(address.sun_path) - 1);
+    REQUIRE(::bind(stalled, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+    REQUIRE(::listen(stalled, 16) == 0);
+    aoc2025::Server server({socket_path.string(), 2});
+    std::thread accept_loop([&server]() { server.run(); });
+    const std::string input = generated(3);
+    aoc2025::ShardOptions options{0, {socket_path.string(), stalled_path.string()}, 4, 3};
+    options.shard_timeout = std::chrono::milliseconds(200);
+
+    // Act
+    aoc2025::Answer answer;
+    aoc2025::ShardStats stats;
+    {
+        aoc2025::Coordinator coordinator(options);
+        answer = coordinator.solve(Day3::Day3, 1, input);
+        stats = coordinator.stats();
+    }
+    server.stop();
+    accept_loop.join();
+    ::close(stalled);
+    std::filesystem::remove(stalled_path);
+
+    // Assert
+    REQUIRE(answer == Day3::Day3.solve(1, input));
+    REQUIRE(stats.retries >= 1);
+    REQUIRE(stats.restarts >= 1);
+}
+
+#ifdef AOC2025_HAVE_ZLIB
+TEST_CASE("Coordinator: Solve File - Compressed Input Sent As Bytes", "[coordinator][integration]") {
+    // Arrange: a daemon that serves no slices, so only shards sent as bytes work
+    register_days();
+    const std::string input = generated(3);
+    std::string compressed(compressBound(static_cast<uLong>(input.size())) + 64, '\0');
+    z_stream stream{};
+    REQUIRE(deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY) == Z_OK);
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+    stream.next_out = reinterpret_cast<Bytef*>(compressed.data());
+    stream.avail_out = static_cast<uInt>(compressed.size());
+    REQUIRE(deflate(&stream, Z_FINISH) == Z_STREAM_END);
+    compressed.resize(stream.total_out);
+    deflateEnd(&stream);
+    const auto path = std::filesystem::temp_directory_path() / "aoc2025_coordinator_day3.txt.gz";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << compressed;
+    }
+    const auto socket_path = std::filesystem::temp_directory_path() / "aoc2025_coordinator_gzip.sock";
+    aoc2025::Server server({socket_path.string(), 2});
+    std::thread accept_loop([&server]() { server.run(); });
+
+    // Act
+    aoc2025::Answer answer;
+    {
+        aoc2025::Coordinator coordinator({0, {socket_path.string()}, 4, 1});
+        answer = coordinator.solve_file(Day3::Day3, 2, path);
+    }
+    server.stop();
+    accept_loop.join();
+    std::filesystem::remove(path);
+
+    // Assert
+    REQUIRE(answer == Day3::Day3.solve(2, input));
+}
+#endif
+#endif
+
+} // namespace coordinator_tests
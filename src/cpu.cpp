@@ -0,0 +1,57 @@
+#include "cpu.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace aoc2025::cpu {
+    Level detected() {
+        static const Level level = [] {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+                return Level::kAvx512;
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                return Level::kAvx2;
+            }
+            if (__builtin_cpu_supports("sse4.2")) {
+                return Level::kSse42;
+            }
+#endif
+            return Level::kGeneric;
+        }();
+        return level;
+    }
+
+    Level active() {
+        static const Level level = [] {
+            const char* requested = std::getenv("AOC2025_CPU");
+            const std::optional<Level> cap = requested != nullptr ? parse_level(requested) : std::nullopt;
+            return cap ? std::min(*cap, detected()) : detected();
+        }();
+        return level;
+    }
+
+    std::string_view name(Level level) {
+        switch (level) {
+            case Level::kSse42:
+                return "sse4.2";
+            case Level::kAvx2:
+                return "avx2";
+            case Level::kAvx512:
+                return "avx512";
+            case Level::kGeneric:
+                break;
+        }
+        return "generic";
+    }
+
+    std::optional<Level> parse_level(std::string_view text) {
+        for (const Level level : {Level::kGeneric, Level::kSse42, Level::kAvx2, Level::kAvx512}) {
+            if (name(level) == text) {
+                return level;
+            }
+        }
+        return std::nullopt;
+    }
+}
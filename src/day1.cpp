@@ -2,10 +2,20 @@
 
 namespace Day1 {
     const aoc2025::Day Day1 {
-        1,
-        "Secret Entrance",
-        &solve_part1,
-        solve_part2
+        .day_number = 1,
+        .title = "Secret Entrance",
+        .part1 = &solve_part1,
+        .part2 = solve_part2,
+        .version = "2",
+        .answer1 = &answer_part1,
+        .answer2 = &answer_part2,
+        .parse = &aoc2025::make_model<DialRotations>,
+        .model1 = &aoc2025::solve_model<DialRotations, &answer_part1>,
+        .model2 = &aoc2025::solve_model<DialRotations, &answer_part2>,
+        .save = &aoc2025::save_model<DialRotations>,
+        .load = &aoc2025::load_model<DialRotations>,
+        .stream = &make_stream,
+        .incremental = &make_incremental
     };
 }
 
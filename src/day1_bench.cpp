@@ -0,0 +1,67 @@
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "bench.hpp"
+#include "day1.hpp"
+#include "generator.hpp"
+
+namespace day1_bench {
+    std::string make_input(std::size_t input_bytes, std::uint64_t seed) {
+        aoc2025::gen::Options options;
+        options.seed = seed;
+        options.bytes = input_bytes;
+        return aoc2025::gen::generate(1, options);
+    }
+
+    const aoc2025::bench::Registrar kDialRotate{
+        "day1/Dial::rotate",
+        [](std::size_t input_bytes, std::uint64_t seed) -> aoc2025::bench::Kernel {
+            auto rotations = std::make_shared<Day1::DialRotations>(make_input(input_bytes, seed));
+            return [rotations]() {
+                Day1::Dial dial;
+                Day1::DialCounter counter(dial, Day1::CountMode::kCountPass);
+                dial.rotate(rotations->get());
+                return static_cast<std::uint64_t>(counter.get_count());
+            };
+        }};
+
+    // Full visit histogram of the default dial
+    const aoc2025::bench::Registrar kVisitHistogram{
+        "day1/VisitCounter::histogram",
+        [](std::size_t input_bytes, std::uint64_t seed) -> aoc2025::bench::Kernel {
+            auto rotations = std::make_shared<Day1::DialRotations>(make_input(input_bytes, seed));
+            return [rotations]() {
+                auto histogram = Day1::VisitCounter::histogram(Day1::WideDial());
+                histogram.rotate(rotations->get());
+                const auto passes = histogram.passes();
+                return passes[0] + passes[50] + histogram.total_ends();
+            };
+        }};
+
+    const aoc2025::bench::Registrar kDialRotationsParse{
+        "day1/DialRotations",
+        [](std::size_t input_bytes, std::uint64_t seed) -> aoc2025::bench::Kernel {
+            auto input = std::make_shared<std::string>(make_input(input_bytes, seed));
+            return [input]() {
+                Day1::DialRotations rotations(*input);
+                return static_cast<std::uint64_t>(rotations.get().size());
+            };
+        }};
+
+    // End to end through the typed solvers, parse included
+    aoc2025::bench::Kernel part_kernel(std::size_t input_bytes, std::uint64_t seed, aoc2025::Day::AnswerFunction part) {
+        auto input = std::make_shared<std::string>(make_input(input_bytes, seed));
+        return [input, part]() {
+            return std::hash<std::string>{}(part(*input).to_string());
+        };
+    }
+
+    const aoc2025::bench::Registrar kPart1{
+        "day1/part1",
+        [](std::size_t input_bytes, std::uint64_t seed) { return part_kernel(input_bytes, seed, &Day1::answer_part1); }};
+
+    const aoc2025::bench::Registrar kPart2{
+        "day1/part2",
+        [](std::size_t input_bytes, std::uint64_t seed) { return part_kernel(input_bytes, seed, &Day1::answer_part2); }};
+}
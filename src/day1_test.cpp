@@ -1,7 +1,11 @@
 #include <catch2/catch_test_macros.hpp>
+#include <limits>
+#include <numeric>
 #include <sstream>
+#include <vector>
 #include "aoc2025.hpp"
 #include "day1.hpp"
+#include "generator.hpp"
 
 static std::string run_part(const aoc2025::Day& day, int part, const std::string& input) {
     std::ostringstream oss;
@@ -58,6 +62,34 @@ TEST_CASE("Day 1: DialRotation - Invalid Zero Steps", "[day1][component][dialrot
     REQUIRE_THROWS_AS(Day1::DialRotation("L0"), std::invalid_argument);
 }
 
+TEST_CASE("Day 1: DialRotation - Steps Beyond 16 Bits Are Rejected", "[day1][component][dialrotation]") {
+    // Assert
+    REQUIRE(Day1::DialRotation("R1000").steps == 1000);
+    REQUIRE(Day1::DialRotation("L65535").steps == 65535);
+    REQUIRE_THROWS_AS(Day1::DialRotation("L65536"), std::invalid_argument);
+    REQUIRE_THROWS_AS(Day1::DialRotation("L300000"), std::invalid_argument);
+    REQUIRE_THROWS_AS(Day1::DialRotation("R-1"), std::invalid_argument);
+}
+
+TEST_CASE("Day 1: DialRotation - try_parse Rejects Steps Beyond 16 Bits", "[day1][component][dialrotation]") {
+    // Assert
+    STATIC_REQUIRE(Day1::DialRotation::try_parse("R1000").has_value());
+    STATIC_REQUIRE(Day1::DialRotation::try_parse("L65535").has_value());
+    STATIC_REQUIRE_FALSE(Day1::DialRotation::try_parse("L65536").has_value());
+    STATIC_REQUIRE_FALSE(Day1::DialRotation::try_parse("R-1").has_value());
+}
+
+TEST_CASE("Day 1: Solve - Rotations Of Many Laps", "[day1][integration]") {
+    // Arrange: R1000 from 50 passes 0 ten times and stops at 50 again, L50
+    // stops at 0 and L1000 makes ten laps back to it
+    const std::string input = "R1000\nL50\nL1000\n";
+
+    // Act & Assert
+    REQUIRE(Day1::answer_part1(input) == aoc2025::Answer(std::int64_t{2}));
+    REQUIRE(Day1::answer_part2(input) == aoc2025::Answer(std::int64_t{21}));
+    STATIC_REQUIRE(Day1::constant::answer_part2("R1000\nL50\nL1000\n") == 21);
+}
+
 TEST_CASE("Day 1: Dial - Rotate Right", "[day1][component][dial]") {
     // Arrange
     Day1::Dial dial;
@@ -232,4 +264,188 @@ TEST_CASE("Day 1: Part 2 - Sample Input", "[day1][integration][part2]") {
     REQUIRE(result == test_day1::kSampleOutput2);
 }
 
+TEST_CASE("Day 1: Stream - Sample Input In Any Chunk Size", "[day1][integration][stream]") {
+    for (const std::size_t chunk_size : {1, 2, 3, 7, 64}) {
+        // Arrange
+        auto part1 = Day1::Day1.stream(1);
+        auto part2 = Day1::Day1.stream(2);
+        
+        // Act
+        const aoc2025::Answer answer1 = aoc2025::stream_solve(*part1, test_day1::kSampleInput, chunk_size);
+        const aoc2025::Answer answer2 = aoc2025::stream_solve(*part2, test_day1::kSampleInput, chunk_size);
+        
+        // Assert
+        REQUIRE(answer1.to_string() == test_day1::kSampleOutput1);
+        REQUIRE(answer2.to_string() == test_day1::kSampleOutput2);
+    }
+}
+
+// The sample, solved by the compiler
+static_assert(Day1::constant::answer_part1("L68\nL30\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82") == 3);
+static_assert(Day1::constant::answer_part2("L68\nL30\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82") == 6);
+
+TEST_CASE("Day 1: Constant - Matches Runtime Solver", "[day1][integration][constant]") {
+    for (const std::uint64_t seed : {1, 2, 3}) {
+        // Arrange
+        aoc2025::gen::Options options;
+        options.seed = seed;
+        options.bytes = 64 * 1024;
+        options.max_steps = 5000;
+        const std::string input = aoc2025::gen::generate(1, options);
+        
+        // Act
+        const auto part1 = Day1::constant::answer_part1(input);
+        const auto part2 = Day1::constant::answer_part2(input);
+        
+        // Assert
+        REQUIRE(part1.has_value());
+        REQUIRE(part2.has_value());
+        REQUIRE(aoc2025::Answer(*part1) == Day1::answer_part1(input));
+        REQUIRE(aoc2025::Answer(*part2) == Day1::answer_part2(input));
+    }
+}
+
+TEST_CASE("Day 1: Constant - Rejects What The Parser Rejects", "[day1][component][constant]") {
+    // Act & Assert
+    REQUIRE_FALSE(Day1::constant::answer_part1("L68\nL0\n").has_value());
+    REQUIRE_FALSE(Day1::constant::answer_part2("L68\nLx\n").has_value());
+    REQUIRE(Day1::constant::answer_part1("L50\r\n\n") == 1);
+}
+
+TEST_CASE("Day 1: Binary Model - Round Trip Keeps Answers", "[day1][integration][binary]") {
+    // Arrange
+    const aoc2025::Day::Model parsed = Day1::Day1.parse_model(test_day1::kSampleInput + "\nR1000\nL65535");
+    
+    // Act
+    const aoc2025::Day::Model loaded = Day1::Day1.load_model(Day1::Day1.save_model(parsed));
+    
+    // Assert
+    REQUIRE(Day1::Day1.solve_parsed(1, loaded) == Day1::Day1.solve_parsed(1, parsed));
+    REQUIRE(Day1::Day1.solve_parsed(2, loaded) == Day1::Day1.solve_parsed(2, parsed));
+    REQUIRE(Day1::Day1.save_model(loaded) == Day1::Day1.save_model(parsed));
+}
+
+TEST_CASE("Day 1: Binary Model - Rejects Malformed Bytes", "[day1][component][binary]") {
+    // Act & Assert: a zero-step rotation
+    REQUIRE_THROWS_AS(Day1::Day1.load_model(std::string("\x01\0\0\0\0\0\0\0\0\0", 10)), std::runtime_error);
+    REQUIRE_THROWS_AS(Day1::Day1.load_model(Day1::Day1.save_model(Day1::Day1.parse_model(test_day1::kSampleInput)) + "x"),
+                      std::runtime_error);
+}
+
 } // namespace day1_tests
+
+// Clicks landing on and rotations stopping at each position, one click at
+// a time: the oracle for VisitCounter
+static void step_histogram(std::int64_t min, std::int64_t max, std::int64_t position,
+                           const std::vector<Day1::WideRotation>& rotations,
+                           std::vector<std::uint64_t>& passes, std::vector<std::uint64_t>& ends) {
+    const std::int64_t size = max - min + 1;
+    passes.assign(static_cast<std::size_t>(size), 0);
+    ends.assign(static_cast<std::size_t>(size), 0);
+    for (const auto& rotation : rotations) {
+        for (std::uint64_t click = 0; click < rotation.steps; ++click) {
+            position += static_cast<int>(rotation.direction);
+            position = position < min ? max : position > max ? min : position;
+            ++passes[static_cast<std::size_t>(position - min)];
+        }
+        ++ends[static_cast<std::size_t>(position - min)];
+    }
+}
+
+TEST_CASE("Day 1: VisitCounter - Histogram Matches Stepping", "[day1][component][visits]") {
+    aoc2025::gen::Random rng(49);
+    for (const std::int64_t size : {1, 2, 7, 100}) {
+        // Arrange
+        const std::int64_t min = static_cast<std::int64_t>(rng.between(0, 20)) - 10;
+        const std::int64_t max = min + size - 1;
+        const std::int64_t start = min + static_cast<std::int64_t>(rng.between(0, static_cast<std::uint64_t>(size - 1)));
+        std::vector<Day1::WideRotation> rotations;
+        for (int i = 0; i < 200; ++i) {
+            rotations.emplace_back(rng.next() & 1 ? Day1::Direction::kLeft : Day1::Direction::kRight,
+                                   rng.between(1, static_cast<std::uint64_t>(size) * 5));
+        }
+        std::vector<std::uint64_t> expected_passes;
+        std::vector<std::uint64_t> expected_ends;
+        step_histogram(min, max, start, rotations, expected_passes, expected_ends);
+
+        // Act
+        auto histogram = Day1::VisitCounter::histogram(Day1::WideDial(min, max, start));
+        for (const auto& rotation : rotations) {
+            histogram.rotate(rotation);
+        }
+
+        // Assert
+        REQUIRE(histogram.passes() == expected_passes);
+        REQUIRE(histogram.ends() == expected_ends);
+        REQUIRE(histogram.total_passes() == std::accumulate(expected_passes.begin(), expected_passes.end(), std::uint64_t{0}));
+        REQUIRE(histogram.total_ends() == rotations.size());
+        REQUIRE(histogram.targets().front() == min);
+    }
+}
+
+TEST_CASE("Day 1: VisitCounter - Target Zero Gives Both Parts", "[day1][integration][visits]") {
+    // Arrange
+    const Day1::DialRotations rotations(test_day1::kSampleInput);
+    const std::vector<std::int64_t> targets{0};
+    Day1::VisitCounter counter(Day1::WideDial(), targets);
+
+    // Act
+    counter.rotate(rotations.get());
+
+    // Assert
+    REQUIRE(std::to_string(counter.total_ends()) == test_day1::kSampleOutput1);
+    REQUIRE(std::to_string(counter.total_passes()) == test_day1::kSampleOutput2);
+}
+
+TEST_CASE("Day 1: VisitCounter - Several Targets", "[day1][component][visits]") {
+    // Arrange: from 50, L68 passes 49..0 and 99..82, R48 then 83..99 and 0..30
+    const std::vector<std::int64_t> targets{90, 0, 40, 0};
+    Day1::VisitCounter counter(Day1::WideDial(), targets);
+
+    // Act
+    counter.rotate(Day1::WideRotation("L68"));
+    counter.rotate(Day1::WideRotation("R48"));
+
+    // Assert
+    REQUIRE(counter.targets() == std::vector<std::int64_t>{0, 40, 90});
+    REQUIRE(counter.passes() == std::vector<std::uint64_t>{2, 1, 2});
+    REQUIRE(counter.total_passes() == 5);
+    REQUIRE(counter.total_ends() == 0);
+    REQUIRE(counter.dial().position() == 30);
+}
+
+TEST_CASE("Day 1: WideDial - 64-bit Ranges And Steps", "[day1][component][visits]") {
+    // Arrange
+    const std::int64_t lowest = std::numeric_limits<std::int64_t>::min();
+    const std::int64_t highest = std::numeric_limits<std::int64_t>::max();
+    const std::vector<std::int64_t> targets{0, 5, 6, 999'999'999'999};
+    Day1::VisitCounter counter(Day1::WideDial(0, 999'999'999'999, 0), targets);
+    Day1::WideDial huge(lowest, highest - 1, highest - 1);
+
+    // Act
+    counter.rotate(Day1::WideRotation("R3000000000005"));
+    const std::uint64_t wrap_visits = huge.visits(Day1::WideRotation(Day1::Direction::kRight, 2), lowest);
+    huge.rotate(Day1::WideRotation(Day1::Direction::kRight, 2));
+
+    // Assert
+    REQUIRE(counter.passes() == std::vector<std::uint64_t>{3, 4, 3, 3});
+    REQUIRE(counter.ends() == std::vector<std::uint64_t>{0, 1, 0, 0});
+    REQUIRE(counter.dial().position() == 5);
+    REQUIRE(wrap_visits == 1);
+    REQUIRE(huge.position() == lowest + 1);
+    REQUIRE(huge.size() == std::numeric_limits<std::uint64_t>::max());
+    STATIC_REQUIRE(Day1::WideDial(-5, 5, 0).visits(Day1::WideRotation(Day1::Direction::kLeft, 30), -5) == 3);
+}
+
+TEST_CASE("Day 1: WideDial - Invalid Ranges And Targets", "[day1][component][visits]") {
+    // Act & Assert
+    const std::vector<std::int64_t> outside{100};
+    REQUIRE_THROWS_AS(Day1::WideDial(5, 4, 5), std::invalid_argument);
+    REQUIRE_THROWS_AS(Day1::WideDial(0, 99, 100), std::invalid_argument);
+    REQUIRE_THROWS_AS(Day1::WideDial(std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max(), 0),
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(Day1::VisitCounter(Day1::WideDial(), outside), std::invalid_argument);
+    REQUIRE_THROWS_AS(Day1::VisitCounter::histogram(Day1::WideDial(0, std::int64_t{1} << 40, 0)), std::invalid_argument);
+    REQUIRE_THROWS_AS(Day1::WideRotation("R0"), std::invalid_argument);
+    REQUIRE(Day1::WideRotation("L123456789012").steps == 123456789012ULL);
+}
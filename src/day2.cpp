@@ -2,10 +2,21 @@
 
 namespace Day2 {
     const aoc2025::Day Day2 {
-        2,
-        "Gift Shop",
-        &solve_part1,
-        solve_part2
+        .day_number = 2,
+        .title = "Gift Shop",
+        .part1 = &solve_part1,
+        .part2 = solve_part2,
+        .version = "2",
+        .answer1 = &answer_part1,
+        .answer2 = &answer_part2,
+        .parse = &aoc2025::make_model<Ranges>,
+        .model1 = &aoc2025::solve_model<Ranges, &answer_part1>,
+        .model2 = &aoc2025::solve_model<Ranges, &answer_part2>,
+        .save = &aoc2025::save_model<Ranges>,
+        .load = &aoc2025::load_model<Ranges>,
+        .stream = &make_stream,
+        .shard_delimiter = ',',
+        .incremental = &make_incremental
     };
 }
 
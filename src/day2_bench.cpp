@@ -0,0 +1,87 @@
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "day2.hpp"
+#include "generator.hpp"
+
+namespace day2_bench {
+    // input_bytes / 8 candidate IDs with 1 to 12 digits, a few of them repeated patterns
+    std::vector<std::int64_t> make_ids(std::size_t input_bytes, std::uint64_t seed) {
+        aoc2025::gen::Random rng(seed);
+        std::vector<std::int64_t> ids(std::max<std::size_t>(input_bytes / sizeof(std::int64_t), 1));
+        for (auto& id : ids) {
+            std::uint64_t limit = 1;
+            for (auto d = rng.between(1, 12); d > 0; --d) {
+                limit *= 10;
+            }
+            id = static_cast<std::int64_t>(rng.between(0, limit - 1));
+            if ((rng.next() & 7) == 0) {
+                // Mix in IDs of concern so both outcomes are exercised
+                id = id % 1000000 * 1000001;
+            }
+        }
+        return ids;
+    }
+
+    std::string make_ranges(std::size_t input_bytes, std::uint64_t seed) {
+        aoc2025::gen::Options options;
+        options.seed = seed;
+        options.bytes = input_bytes;
+        return aoc2025::gen::generate(2, options);
+    }
+
+    template <typename Checker>
+    aoc2025::bench::Kernel id_kernel(std::size_t input_bytes, std::uint64_t seed, Checker checker) {
+        auto ids = std::make_shared<std::vector<std::int64_t>>(make_ids(input_bytes, seed));
+        return [ids, checker]() {
+            std::uint64_t sum = 0;
+            for (const std::int64_t id : *ids) {
+                if (auto found = checker(id)) {
+                    sum += static_cast<std::uint64_t>(*found);
+                }
+            }
+            return sum;
+        };
+    }
+
+    const aoc2025::bench::Registrar kPart1IdOfConcern{
+        "day2/Part1IdOfConcern",
+        [](std::size_t input_bytes, std::uint64_t seed) {
+            return id_kernel(input_bytes, seed, Day2::Part1IdOfConcern);
+        }};
+
+    const aoc2025::bench::Registrar kPart2IdOfConcern{
+        "day2/Part2IdOfConcern",
+        [](std::size_t input_bytes, std::uint64_t seed) {
+            return id_kernel(input_bytes, seed, Day2::Part2IdOfConcern);
+        }};
+
+    const aoc2025::bench::Registrar kRangesParse{
+        "day2/Ranges",
+        [](std::size_t input_bytes, std::uint64_t seed) -> aoc2025::bench::Kernel {
+            auto input = std::make_shared<std::string>(make_ranges(input_bytes, seed));
+            return [input]() {
+                Day2::Ranges ranges(*input);
+                return static_cast<std::uint64_t>(ranges.get().size());
+            };
+        }};
+
+    // End to end through the typed solvers, parse included
+    aoc2025::bench::Kernel part_kernel(std::size_t input_bytes, std::uint64_t seed, aoc2025::Day::AnswerFunction part) {
+        auto input = std::make_shared<std::string>(make_ranges(input_bytes, seed));
+        return [input, part]() {
+            return std::hash<std::string>{}(part(*input).to_string());
+        };
+    }
+
+    const aoc2025::bench::Registrar kPart1{
+        "day2/part1",
+        [](std::size_t input_bytes, std::uint64_t seed) { return part_kernel(input_bytes, seed, &Day2::answer_part1); }};
+
+    const aoc2025::bench::Registrar kPart2{
+        "day2/part2",
+        [](std::size_t input_bytes, std::uint64_t seed) { return part_kernel(input_bytes, seed, &Day2::answer_part2); }};
+}
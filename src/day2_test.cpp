@@ -1,7 +1,9 @@
 #include <catch2/catch_test_macros.hpp>
+#include <limits>
 #include <sstream>
 #include "aoc2025.hpp"
 #include "day2.hpp"
+#include "generator.hpp"
 
 static std::string run_part(const aoc2025::Day& day, int part, const std::string& input) {
     std::ostringstream oss;
@@ -301,5 +303,107 @@ TEST_CASE("Day 2: Part 2 - Range With Repeating Pattern Numbers", "[day2][integr
     REQUIRE(result == "333");
 }
 
+TEST_CASE("Day 2: Stream - Sample Input In Any Chunk Size", "[day2][integration][stream]") {
+    for (const std::size_t chunk_size : {1, 2, 3, 7, 64}) {
+        // Arrange
+        auto part1 = Day2::Day2.stream(1);
+        auto part2 = Day2::Day2.stream(2);
+        
+        // Act
+        const aoc2025::Answer answer1 = aoc2025::stream_solve(*part1, test_day2::kSampleInput, chunk_size);
+        const aoc2025::Answer answer2 = aoc2025::stream_solve(*part2, test_day2::kSampleInput, chunk_size);
+        
+        // Assert
+        REQUIRE(answer1.to_string() == test_day2::kSampleOutput);
+        REQUIRE(answer2 == Day2::answer_part2(test_day2::kSampleInput));
+    }
+}
+
+TEST_CASE("Day 2: Solve - Total That Overflows Throws", "[day2][integration]") {
+    // Arrange: each range sums to 9e17, which fits, but eleven of them do not
+    std::string input;
+    for (int i = 0; i < 11; ++i) {
+        input += (i == 0 ? "" : ",") + std::string("900000000900000000-900000000900000000");
+    }
+    const std::string ten = input.substr(0, input.rfind(','));
+
+    // Act & Assert
+    REQUIRE(Day2::answer_part1(ten).to_string() == "9000000009000000000");
+    REQUIRE_THROWS_AS(Day2::answer_part1(input), std::overflow_error);
+    REQUIRE_THROWS_AS(Day2::answer_part2(input), std::overflow_error);
+    auto stream = Day2::Day2.stream(1);
+    REQUIRE_THROWS_AS(aoc2025::stream_solve(*stream, input, 64), std::overflow_error);
+}
+
+#ifdef AOC2025_HAVE_INT128
+// The sample, solved by the compiler
+static_assert(Day2::constant::answer_part1("11-22,95-115,998-1012,1188511880-1188511890,222220-222224,1698522-1698528,"
+                                           "446443-446449,38593856-38593862,565653-565659,824824821-824824827,"
+                                           "2121212118-2121212124") == 1227775554);
+static_assert(Day2::constant::answer_part2("11-22,95-115,998-1012,1188511880-1188511890,222220-222224,1698522-1698528,"
+                                           "446443-446449,38593856-38593862,565653-565659,824824821-824824827,"
+                                           "2121212118-2121212124") == 4174379265);
+
+TEST_CASE("Day 2: Constant - Matches Runtime Solver", "[day2][integration][constant]") {
+    for (const std::uint64_t seed : {1, 2, 3}) {
+        // Arrange
+        aoc2025::gen::Options options;
+        options.seed = seed;
+        options.bytes = 16 * 1024;
+        const std::string input = aoc2025::gen::generate(2, options);
+        
+        // Act
+        const auto part1 = Day2::constant::answer_part1(input);
+        const auto part2 = Day2::constant::answer_part2(input);
+        
+        // Assert
+        REQUIRE(part1.has_value());
+        REQUIRE(part2.has_value());
+        REQUIRE(aoc2025::Answer(*part1) == Day2::answer_part1(input));
+        REQUIRE(aoc2025::Answer(*part2) == Day2::answer_part2(input));
+    }
+}
+
+TEST_CASE("Day 2: Generator - Rejects A Width That Overflows", "[day2][component]") {
+    // Arrange
+    aoc2025::gen::Options options;
+    options.bytes = 1024;
+    options.max_digits = 17;
+
+    // Act & Assert
+    options.range_width = std::numeric_limits<std::uint64_t>::max() - 99999999999999999ULL;
+    REQUIRE_FALSE(aoc2025::gen::generate(2, options).empty());
+    options.range_width += 1;
+    REQUIRE_THROWS_AS(aoc2025::gen::generate(2, options), std::invalid_argument);
+}
+
+TEST_CASE("Day 2: Constant - Rejects What The Parser Rejects", "[day2][component][constant]") {
+    // Act & Assert
+    REQUIRE_FALSE(Day2::constant::answer_part1("11-22,30-20").has_value());
+    REQUIRE_FALSE(Day2::constant::answer_part2("11-22,-5").has_value());
+    REQUIRE(Day2::constant::answer_part1(" 11-22 ,\n") == 33);
+}
+#endif
+
+TEST_CASE("Day 2: Binary Model - Round Trip Keeps Answers", "[day2][integration][binary]") {
+    // Arrange
+    const aoc2025::Day::Model parsed = Day2::Day2.parse_model(test_day2::kSampleInput);
+    
+    // Act
+    const aoc2025::Day::Model loaded = Day2::Day2.load_model(Day2::Day2.save_model(parsed));
+    
+    // Assert
+    REQUIRE(Day2::Day2.solve_parsed(1, loaded) == Day2::Day2.solve_parsed(1, parsed));
+    REQUIRE(Day2::Day2.solve_parsed(2, loaded) == Day2::Day2.solve_parsed(2, parsed));
+    REQUIRE(Day2::Day2.save_model(loaded) == Day2::Day2.save_model(parsed));
+}
+
+TEST_CASE("Day 2: Binary Model - Rejects Malformed Bytes", "[day2][component][binary]") {
+    // Act & Assert: a truncated range
+    REQUIRE_THROWS_AS(Day2::Day2.load_model(std::string("\x01\0\0\0\0\0\0\0\x05", 9)), std::runtime_error);
+    REQUIRE_THROWS_AS(Day2::Day2.load_model(Day2::Day2.save_model(Day2::Day2.parse_model(test_day2::kSampleInput)) + "x"),
+                      std::runtime_error);
+}
+
 } // namespace day2_tests
 
@@ -2,10 +2,20 @@
 
 namespace Day3 {
     const aoc2025::Day Day3 {
-        3,
-        "Lobby",
-        &solve_part1,
-        solve_part2
+        .day_number = 3,
+        .title = "Lobby",
+        .part1 = &solve_part1,
+        .part2 = solve_part2,
+        .answer1 = &answer_part1,
+        .answer2 = &answer_part2,
+        .parse = &aoc2025::make_model<Banks>,
+        .model1 = &aoc2025::solve_model<Banks, &answer_part1>,
+        .model2 = &aoc2025::solve_model<Banks, &answer_part2>,
+        .save = &aoc2025::save_model<Banks>,
+        .load = &aoc2025::load_model<Banks>,
+        .stream = &make_stream,
+        .shard_delimiter = '\n',
+        .incremental = &make_incremental
     };
 }
 
@@ -0,0 +1,75 @@
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "day3.hpp"
+#include "generator.hpp"
+
+namespace day3_bench {
+    // Banks of 100 random digits adding up to roughly input_bytes bytes
+    std::vector<Day3::Bank> make_banks(std::size_t input_bytes, std::uint64_t seed) {
+        aoc2025::gen::Options options;
+        options.seed = seed;
+        options.bytes = input_bytes;
+        const Day3::Banks banks(aoc2025::gen::generate(3, options));
+        return {banks.begin(), banks.end()};
+    }
+
+    template <typename Solve>
+    aoc2025::bench::Kernel bank_kernel(std::size_t input_bytes, std::uint64_t seed, Solve solve) {
+        auto banks = std::make_shared<std::vector<Day3::Bank>>(make_banks(input_bytes, seed));
+        return [banks, solve]() {
+            std::uint64_t sum = 0;
+            for (const auto& bank : *banks) {
+                sum += static_cast<std::uint64_t>(solve(bank));
+            }
+            return sum;
+        };
+    }
+
+    const aoc2025::bench::Registrar kMaxPair{
+        "day3/Bank::max_pair",
+        [](std::size_t input_bytes, std::uint64_t seed) {
+            return bank_kernel(input_bytes, seed, [](const Day3::Bank& bank) { return bank.max_pair(); });
+        }};
+
+    const aoc2025::bench::Registrar kMaxN{
+        "day3/Bank::max_n",
+        [](std::size_t input_bytes, std::uint64_t seed) {
+            return bank_kernel(input_bytes, seed, [](const Day3::Bank& bank) { return bank.max_n(12); });
+        }};
+
+    const aoc2025::bench::Registrar kBanksParse{
+        "day3/Banks",
+        [](std::size_t input_bytes, std::uint64_t seed) -> aoc2025::bench::Kernel {
+            aoc2025::gen::Options options;
+            options.seed = seed;
+            options.bytes = input_bytes;
+            auto input = std::make_shared<std::string>(aoc2025::gen::generate(3, options));
+            return [input]() {
+                Day3::Banks banks(*input);
+                return static_cast<std::uint64_t>(banks.get().size());
+            };
+        }};
+
+    // End to end through the typed solvers, parse included
+    aoc2025::bench::Kernel part_kernel(std::size_t input_bytes, std::uint64_t seed, aoc2025::Day::AnswerFunction part) {
+        aoc2025::gen::Options options;
+        options.seed = seed;
+        options.bytes = input_bytes;
+        auto input = std::make_shared<std::string>(aoc2025::gen::generate(3, options));
+        return [input, part]() {
+            return std::hash<std::string>{}(part(*input).to_string());
+        };
+    }
+
+    const aoc2025::bench::Registrar kPart1{
+        "day3/part1",
+        [](std::size_t input_bytes, std::uint64_t seed) { return part_kernel(input_bytes, seed, &Day3::answer_part1); }};
+
+    const aoc2025::bench::Registrar kPart2{
+        "day3/part2",
+        [](std::size_t input_bytes, std::uint64_t seed) { return part_kernel(input_bytes, seed, &Day3::answer_part2); }};
+}
@@ -1,7 +1,9 @@
 #include <catch2/catch_test_macros.hpp>
+#include <memory_resource>
 #include <sstream>
 #include "aoc2025.hpp"
 #include "day3.hpp"
+#include "generator.hpp"
 
 static std::string run_part(const aoc2025::Day& day, int part, const std::string& input) {
     std::ostringstream oss;
@@ -52,7 +54,7 @@ TEST_CASE("Day 3: Bank - Create from String View", "[day3][component][bank]") {
     std::string input = "12345";
     
     // Act
-    Day3::Bank bank(std::string_view(input));
+    Day3::Bank bank{std::string_view(input)};
     
     // Assert
     REQUIRE(bank.size() == 5);
@@ -338,4 +340,124 @@ TEST_CASE("Day 3: Part 2 - Line Too Short", "[day3][integration][part2]") {
     REQUIRE(result == "0");
 }
 
+TEST_CASE("Day 3: Banks - Skips Blank And Invalid Lines", "[day3][component][banks]") {
+    // Arrange & Act
+    Day3::Banks banks("987654321111111\n\n  12ab34\n123456789\r\n");
+    
+    // Assert
+    REQUIRE(banks.get().size() == 2);
+    REQUIRE(banks.get()[1].size() == 9);
+}
+
+TEST_CASE("Day 3: Banks - Allocates From The Given Resource", "[day3][component][banks]") {
+    // Arrange: a resource that counts what it hands out and falls back to nothing else
+    struct CountingResource : std::pmr::memory_resource {
+        std::size_t allocations = 0;
+        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource();
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            ++allocations;
+            return upstream->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+            upstream->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+    } counting;
+    
+    // Act
+    Day3::Banks banks(test_day3::kSampleInput, &counting);
+    
+    // Assert: one block for the bank array plus one per bank's digits
+    REQUIRE(banks.get().size() == 3);
+    REQUIRE(counting.allocations == 4);
+    REQUIRE(banks.get()[0].get_digits().get_allocator().resource() == &counting);
+    REQUIRE(Day3::answer_part1(banks).to_string() == test_day3::kSampleOutput1);
+}
+
+TEST_CASE("Day 3: Parse Stage - Both Parts From One Model", "[day3][integration][parse]") {
+    // Arrange
+    REQUIRE(Day3::Day3.has_parse_stage());
+    
+    // Act
+    const aoc2025::Day::Model model = Day3::Day3.parse_model(test_day3::kSampleInput);
+    
+    // Assert
+    REQUIRE(Day3::Day3.solve_parsed(1, model).to_string() == test_day3::kSampleOutput1);
+    REQUIRE(Day3::Day3.solve_parsed(2, model) == Day3::answer_part2(test_day3::kSampleInput));
+}
+
+TEST_CASE("Day 3: Stream - Sample Input In Any Chunk Size", "[day3][integration][stream]") {
+    // Blank and invalid lines are skipped exactly as in Banks
+    const std::string input = test_day3::kSampleInput + "\n\n12a45\r\n818181911112111\n";
+    for (const std::size_t chunk_size : {1, 2, 3, 7, 64}) {
+        // Arrange
+        auto part1 = Day3::Day3.stream(1);
+        auto part2 = Day3::Day3.stream(2);
+        
+        // Act
+        const aoc2025::Answer answer1 = aoc2025::stream_solve(*part1, input, chunk_size);
+        const aoc2025::Answer answer2 = aoc2025::stream_solve(*part2, input, chunk_size);
+        
+        // Assert
+        REQUIRE(answer1 == Day3::answer_part1(input));
+        REQUIRE(answer2 == Day3::answer_part2(input));
+    }
+}
+
+// The sample, solved by the compiler
+static_assert(Day3::constant::answer_part1("987654321111111\n123456789\n999888777") == 286);
+static_assert(Day3::constant::answer_part2("987654321111111\n123456789\n999888777") == 987654321111);
+
+TEST_CASE("Day 3: Constant - Matches Runtime Solver", "[day3][integration][constant]") {
+    for (const std::uint64_t seed : {1, 2, 3}) {
+        // Arrange
+        aoc2025::gen::Options options;
+        options.seed = seed;
+        options.bytes = 64 * 1024;
+        const std::string input = aoc2025::gen::generate(3, options);
+        
+        // Act
+        const auto part1 = Day3::constant::answer_part1(input);
+        const auto part2 = Day3::constant::answer_part2(input);
+        
+        // Assert
+        REQUIRE(part1.has_value());
+        REQUIRE(part2.has_value());
+        REQUIRE(aoc2025::Answer(*part1) == Day3::answer_part1(input));
+        REQUIRE(aoc2025::Answer(*part2) == Day3::answer_part2(input));
+    }
+}
+
+TEST_CASE("Day 3: Constant - Skips Lines Banks Skips", "[day3][component][constant]") {
+    // Arrange
+    const std::string input = "987654321111111\r\n12a4\n\n999888777000\n";
+    
+    // Act & Assert
+    REQUIRE(aoc2025::Answer(*Day3::constant::answer_part1(input)) == Day3::answer_part1(input));
+    REQUIRE(aoc2025::Answer(*Day3::constant::answer_part2(input)) == Day3::answer_part2(input));
+}
+
+TEST_CASE("Day 3: Binary Model - Round Trip Keeps Answers", "[day3][integration][binary]") {
+    // Arrange
+    const aoc2025::Day::Model parsed = Day3::Day3.parse_model(test_day3::kSampleInput);
+    
+    // Act
+    const aoc2025::Day::Model loaded = Day3::Day3.load_model(Day3::Day3.save_model(parsed));
+    
+    // Assert
+    REQUIRE(Day3::Day3.solve_parsed(1, loaded) == Day3::Day3.solve_parsed(1, parsed));
+    REQUIRE(Day3::Day3.solve_parsed(2, loaded) == Day3::Day3.solve_parsed(2, parsed));
+    REQUIRE(Day3::Day3.save_model(loaded) == Day3::Day3.save_model(parsed));
+}
+
+TEST_CASE("Day 3: Binary Model - Rejects Malformed Bytes", "[day3][component][binary]") {
+    // Act & Assert: a bank past the end of its digits
+    REQUIRE_THROWS_AS(Day3::Day3.load_model(std::string("\x01\0\0\0\0\0\0\0\x09\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0\x07", 25)), std::runtime_error);
+    REQUIRE_THROWS_AS(Day3::Day3.load_model(Day3::Day3.save_model(Day3::Day3.parse_model(test_day3::kSampleInput)) + "x"),
+                      std::runtime_error);
+}
+
 } // namespace day3_tests
@@ -0,0 +1,89 @@
+#include "embedded.hpp"
+
+#include <array>
+#include <cstdint>
+
+#include "day1.hpp"
+#include "day2.hpp"
+#include "day3.hpp"
+
+#ifdef AOC2025_EMBED_INPUTS
+// Generated at configure time from dayN/data.txt, defines kInputs
+#include "embedded_inputs.hpp"
+#else
+namespace aoc2025::embedded {
+    inline constexpr std::array<EmbeddedInput, 0> kInputs{};
+}
+#endif
+
+namespace aoc2025::embedded {
+    namespace {
+        // Constant evaluation needs the solvers named statically, so days are
+        // listed here rather than looked up in the registry
+        constexpr std::optional<std::int64_t> solve(int day_number, int part, std::string_view text) {
+            switch (day_number) {
+                case 1:
+                    return part == 1 ? Day1::constant::answer_part1(text) : Day1::constant::answer_part2(text);
+#ifdef AOC2025_HAVE_INT128
+                case 2:
+                    return part == 1 ? Day2::constant::answer_part1(text) : Day2::constant::answer_part2(text);
+#endif
+                case 3:
+                    return part == 1 ? Day3::constant::answer_part1(text) : Day3::constant::answer_part2(text);
+                default:
+                    return std::nullopt;
+            }
+        }
+
+        struct Solved {
+            std::optional<std::int64_t> part1;
+            std::optional<std::int64_t> part2;
+        };
+
+        // Both parts of every embedded input, evaluated by the compiler
+        constexpr auto kAnswers = [] {
+            std::array<Solved, kInputs.size()> answers{};
+            for (std::size_t i = 0; i < kInputs.size(); ++i) {
+                answers[i] = Solved{solve(kInputs[i].day_number, 1, kInputs[i].text),
+                                    solve(kInputs[i].day_number, 2, kInputs[i].text)};
+            }
+            return answers;
+        }();
+
+        constexpr const EmbeddedInput* find(int day_number) {
+            for (const EmbeddedInput& entry : kInputs) {
+                if (entry.day_number == day_number) {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+    }
+
+    bool enabled() {
+#ifdef AOC2025_EMBED_INPUTS
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::optional<std::string_view> input(int day_number) {
+        if (const EmbeddedInput* entry = find(day_number)) {
+            return entry->text;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<Answer> answer(int day_number, int part) {
+        for (std::size_t i = 0; i < kInputs.size(); ++i) {
+            if (kInputs[i].day_number == day_number) {
+                const std::optional<std::int64_t>& solved = part == 1 ? kAnswers[i].part1 : kAnswers[i].part2;
+                if (solved) {
+                    return Answer(*solved);
+                }
+            }
+        }
+        return std::nullopt;
+    }
+}
@@ -0,0 +1,39 @@
+#include <catch2/catch_test_macros.hpp>
+#include "aoc2025.hpp"
+#include "day1.hpp"
+#include "day2.hpp"
+#include "day3.hpp"
+#include "embedded.hpp"
+
+namespace embedded_tests {
+
+TEST_CASE("Embedded: Answers - Match Runtime Solvers On Embedded Inputs", "[embedded][integration]") {
+    for (const aoc2025::Day* day : {&Day1::Day1, &Day2::Day2, &Day3::Day3}) {
+        // Arrange
+        const auto input = aoc2025::embedded::input(day->day_number);
+        if (!input) {
+            continue;
+        }
+        
+        for (int part = 1; part <= 2; ++part) {
+            // Act
+            const auto answer = aoc2025::embedded::answer(day->day_number, part);
+            
+            // Assert
+            INFO("day " << day->day_number << " part " << part);
+            REQUIRE(answer.has_value());
+            REQUIRE(*answer == day->solve(part, *input));
+        }
+    }
+}
+
+TEST_CASE("Embedded: Answers - None Without Embedded Input", "[embedded][component]") {
+    // Act & Assert
+    REQUIRE_FALSE(aoc2025::embedded::input(99).has_value());
+    REQUIRE_FALSE(aoc2025::embedded::answer(99, 1).has_value());
+    if (!aoc2025::embedded::enabled()) {
+        REQUIRE_FALSE(aoc2025::embedded::input(1).has_value());
+    }
+}
+
+} // namespace embedded_tests
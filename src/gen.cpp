@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "generator.hpp"
+#include "size.hpp"
+
+namespace {
+    void print_usage(const char* program) {
+        std::cerr << "Usage: " << program << " --day N [options]\n"
+                  << "  --day N             day to generate input for\n"
+                  << "  --size SIZE         approximate output size, e.g. 64M or 20G (default 1M)\n"
+                  << "  --seed N            random seed (default 2025)\n"
+                  << "  -o FILE             write to FILE instead of stdout\n"
+                  << "Day 1:\n"
+                  << "  --max-steps N       largest rotation, 1-65535 (default 99)\n"
+                  << "Day 2:\n"
+                  << "  --width N           widest range end - start (default 1000)\n"
+                  << "  --overlap PERCENT   share of ranges overlapping the previous one (default 0)\n"
+                  << "  --digits N          digits in range starts, 1-17 (default 10)\n"
+                  << "Day 3:\n"
+                  << "  --line-length N     digits per bank (default 100)\n"
+                  << "  --digit-weights W   ten comma-separated weights for digits 0-9 (default 0,1,1,1,1,1,1,1,1,1)\n";
+    }
+
+    // Whole-string unsigned decimal, so "12x" or "-1" is not silently read as something else
+    bool parse_number(const std::string& text, std::uint64_t& value) {
+        const char* end = text.data() + text.size();
+        const auto [stop, error] = std::from_chars(text.data(), end, value);
+        return !text.empty() && error == std::errc() && stop == end;
+    }
+
+    bool parse_weights(const std::string& text, std::array<std::uint32_t, 10>& weights) {
+        std::istringstream stream(text);
+        std::string token;
+        std::size_t count = 0;
+        while (std::getline(stream, token, ',')) {
+            if (count == weights.size() || token.empty()) {
+                return false;
+            }
+            weights[count++] = static_cast<std::uint32_t>(std::strtoul(token.c_str(), nullptr, 10));
+        }
+        return count == weights.size();
+    }
+}
+
+int main(int argc, char* argv[]) {
+    aoc2025::gen::Options options;
+    int day_number = 0;
+    std::string output_path;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (i + 1 >= argc) {
+            print_usage(argv[0]);
+            return 1;
+        }
+        const std::string value = argv[++i];
+        std::uint64_t number = 0;
+        const bool numeric = parse_number(value, number);
+        const bool takes_number = arg == "--day" || arg == "--seed" || arg == "--max-steps" || arg == "--width" ||
+                                  arg == "--overlap" || arg == "--digits" || arg == "--line-length";
+        if (takes_number && !numeric) {
+            std::cerr << "Invalid value for " << arg << ": " << value << '\n';
+            return 1;
+        }
+        if (arg == "--day") {
+            day_number = static_cast<int>(std::min<std::uint64_t>(number, 1000));
+        } else if (arg == "--size") {
+            options.bytes = aoc2025::parse_size(value);
+            if (options.bytes == 0) {
+                std::cerr << "Invalid --size: " << value << '\n';
+                return 1;
+            }
+        } else if (arg == "--seed") {
+            options.seed = number;
+        } else if (arg == "-o") {
+            output_path = value;
+        } else if (arg == "--max-steps") {
+            options.max_steps = number;
+        } else if (arg == "--width") {
+            options.range_width = number;
+        } else if (arg == "--overlap") {
+            options.overlap_percent = number;
+        } else if (arg == "--digits") {
+            options.max_digits = number;
+        } else if (arg == "--line-length") {
+            options.line_length = number;
+        } else if (arg == "--digit-weights") {
+            if (!parse_weights(value, options.digit_weights)) {
+                std::cerr << "Invalid digit weights: " << value << '\n';
+                return 1;
+            }
+        } else {
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    const auto it = aoc2025::gen::generators().find(day_number);
+    if (it == aoc2025::gen::generators().end()) {
+        std::cerr << "No generator for day " << day_number << '\n';
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    std::FILE* file = output_path.empty() ? stdout : std::fopen(output_path.c_str(), "wb");
+    if (file == nullptr) {
+        std::cerr << "Error opening " << output_path << " for writing\n";
+        return 1;
+    }
+
+    try {
+        aoc2025::gen::Writer out(file);
+        it->second(out, options);
+        out.flush();
+    } catch (const std::exception& error) {
+        std::cerr << error.what() << '\n';
+        return 1;
+    }
+
+    if (file != stdout) {
+        std::fclose(file);
+    }
+    return 0;
+}
@@ -0,0 +1,269 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include "aoc2025.hpp"
+#include "day1.hpp"
+#include "day2.hpp"
+#include "day3.hpp"
+#include "generator.hpp"
+#include "incremental.hpp"
+#include "watch.hpp"
+
+namespace incremental_tests {
+
+static std::string generated(int day_number, std::uint64_t bytes = 32 << 10) {
+    aoc2025::gen::Options options;
+    options.bytes = bytes;
+    return aoc2025::gen::generate(day_number, options);
+}
+
+static void require_answers(const aoc2025::Day& day, const aoc2025::IncrementalSolver& solver) {
+    REQUIRE(solver.answer(1) == day.solve(1, solver.text()));
+    REQUIRE(solver.answer(2) == day.solve(2, solver.text()));
+}
+
+// Apply an edit that may leave the input invalid: then the solver must
+// reject it as the full solve does, and keep the last good version
+static void apply_or_reject(const aoc2025::Day& day, aoc2025::IncrementalSolver& solver, const aoc2025::Edit& edit) {
+    const std::string before(solver.text());
+    std::string after = before;
+    after.replace(edit.offset, edit.erased, edit.inserted);
+    bool valid = true;
+    try {
+        static_cast<void>(day.solve(1, after));
+    } catch (const std::exception&) {
+        valid = false;
+    }
+    if (valid) {
+        solver.apply(edit);
+        REQUIRE(solver.text() == after);
+    } else {
+        REQUIRE_THROWS(solver.apply(edit));
+        REQUIRE(solver.text() == before);
+    }
+    require_answers(day, solver);
+}
+
+// Random edits on whole records: replace, insert and delete runs of them
+static void check_random_edits(const aoc2025::Day& day, char delimiter) {
+    const std::string input = generated(day.day_number);
+    const auto solver = day.incremental();
+    solver->update(input);
+    require_answers(day, *solver);
+
+    aoc2025::gen::Random rng(day.day_number);
+    const std::string other = generated(day.day_number, 4 << 10);
+    for (int round = 0; round < 40; ++round) {
+        const std::string text(solver->text());
+        std::size_t begin = text.find(delimiter, rng.between(0, text.size() - 1));
+        begin = begin == std::string::npos ? text.size() : begin + 1;
+        std::size_t end = text.find(delimiter, std::min(text.size(), begin + rng.between(0, 64)));
+        end = end == std::string::npos || round % 7 == 0 ? begin : end + 1;
+        std::size_t from = other.find(delimiter, rng.between(0, other.size() - 1));
+        from = from == std::string::npos ? 0 : from + 1;
+        std::string inserted = other.substr(from, rng.between(0, 48));
+        const std::size_t cut = inserted.rfind(delimiter);
+        inserted.resize(cut == std::string::npos || round % 5 == 0 ? 0 : cut + 1);
+
+        const std::size_t records = solver->apply({begin, end - begin, inserted});
+
+        if (day.day_number != 1) {
+            REQUIRE(records <= 12);
+        }
+        require_answers(day, *solver);
+    }
+}
+
+TEST_CASE("Incremental: diff - Smallest Edit", "[incremental][component]") {
+    // Arrange
+    const std::string large(10000, 'x');
+
+    // Act
+    const aoc2025::Edit same = aoc2025::diff("abc", "abc");
+    const aoc2025::Edit insert = aoc2025::diff("abcdef", "abcXYdef");
+    const aoc2025::Edit erase = aoc2025::diff("abcdef", "abef");
+    const aoc2025::Edit repeated = aoc2025::diff("aaa", "aaaa");
+    const aoc2025::Edit from_empty = aoc2025::diff("", "L5\n");
+    const aoc2025::Edit in_large = aoc2025::diff(large, large.substr(0, 6000) + "y" + large.substr(6001));
+
+    // Assert
+    REQUIRE((same.erased == 0 && same.inserted.empty()));
+    REQUIRE((insert.offset == 3 && insert.erased == 0 && insert.inserted == "XY"));
+    REQUIRE((erase.offset == 2 && erase.erased == 2 && erase.inserted.empty()));
+    REQUIRE((repeated.offset == 3 && repeated.erased == 0 && repeated.inserted == "a"));
+    REQUIRE((from_empty.offset == 0 && from_empty.erased == 0 && from_empty.inserted == "L5\n"));
+    REQUIRE((in_large.offset == 6000 && in_large.erased == 1 && in_large.inserted == "y"));
+}
+
+TEST_CASE("Incremental: Day 1 - Random Edits Match Full Solve", "[incremental][day1][component]") {
+    check_random_edits(Day1::Day1, '\n');
+}
+
+TEST_CASE("Incremental: Day 2 - Random Edits Match Full Solve", "[incremental][day2][component]") {
+    check_random_edits(Day2::Day2, ',');
+}
+
+TEST_CASE("Incremental: Day 3 - Random Edits Match Full Solve", "[incremental][day3][component]") {
+    check_random_edits(Day3::Day3, '\n');
+}
+
+TEST_CASE("Incremental: Records - Merge, Split, Append, Prepend, Replace", "[incremental][component]") {
+    for (const aoc2025::Day* day : {&Day1::Day1, &Day2::Day2, &Day3::Day3}) {
+        // Arrange
+        const char delimiter = day->day_number == 2 ? ',' : '\n';
+        const std::string input = generated(day->day_number, 2 << 10);
+        const auto solver = day->incremental();
+        solver->update(input);
+        const std::size_t first_delimiter = input.find(delimiter);
+        const std::string first_record = input.substr(0, first_delimiter + 1);
+
+        // Act & Assert: drop a delimiter so two records run together, which
+        // only day 3 accepts, then split a record in two
+        apply_or_reject(*day, *solver, {first_delimiter, 1, ""});
+        if (solver->text() != input) {
+            apply_or_reject(*day, *solver, {first_delimiter, 0, std::string(1, delimiter)});
+        }
+        REQUIRE(solver->text() == input);
+        const std::string split = day->day_number == 1 ? "1\nL" : day->day_number == 2 ? "1,1-" : "\n";
+        apply_or_reject(*day, *solver, {first_delimiter - 1, 0, split});
+
+        // Append, prepend, then a whole new input and an empty one
+        // Day 2 ends in a newline after its last range, so the new range goes
+        // before it
+        const std::string body = input.substr(0, input.find_last_not_of('\n') + 1);
+        solver->update(body + delimiter + first_record.substr(0, first_delimiter) + '\n');
+        require_answers(*day, *solver);
+        solver->update(first_record + input);
+        require_answers(*day, *solver);
+        solver->update(generated(day->day_number, 3 << 10));
+        require_answers(*day, *solver);
+        solver->update("");
+        require_answers(*day, *solver);
+        solver->update(input);
+        require_answers(*day, *solver);
+    }
+}
+
+TEST_CASE("Incremental: Day 3 - Unchanged Lines Are Not Re-solved", "[incremental][day3][component]") {
+    // Arrange
+    const std::string input = generated(3, 256 << 10);
+    const auto solver = Day3::make_incremental();
+    solver->update(input);
+    std::string edited = input;
+    const std::size_t middle = edited.find('\n', edited.size() / 2) + 1;
+    edited[middle] = edited[middle] == '9' ? '1' : '9';
+
+    // Act
+    const std::size_t records = solver->update(edited);
+
+    // Assert
+    REQUIRE(records == 1);
+    require_answers(Day3::Day3, *solver);
+}
+
+TEST_CASE("Incremental: Day 1 - Re-solves Until The Dial Catches Up", "[incremental][day1][component]") {
+    // Arrange
+    const std::string input = "L68\nL30\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82\n";
+    const auto solver = Day1::make_incremental();
+    solver->update(input);
+
+    // Act: the same net rotation, split over two lines
+    const std::size_t same_end = solver->update("L68\nL10\nL20\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82\n");
+    const aoc2025::Answer passes = solver->answer(2);
+    // A different one, so every later line ends elsewhere
+    const std::size_t moved = solver->update("L67\nL10\nL20\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82\n");
+
+    // Assert
+    REQUIRE(same_end == 2);
+    REQUIRE(passes == Day1::Day1.solve(2, "L68\nL10\nL20\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82\n"));
+    REQUIRE(moved == 11);
+    require_answers(Day1::Day1, *solver);
+}
+
+TEST_CASE("Incremental: apply - Errors Leave The Solver Unchanged", "[incremental][component]") {
+    // Arrange
+    const std::string input = "11-22,95-115,998-1012";
+    const auto solver = Day2::make_incremental();
+    solver->update(input);
+    const aoc2025::Answer before = solver->answer(1);
+
+    // Act & Assert
+    REQUIRE_THROWS_AS(solver->apply({input.size() + 1, 0, "1"}), std::out_of_range);
+    REQUIRE_THROWS_AS(solver->apply({5, input.size(), ""}), std::out_of_range);
+    REQUIRE_THROWS(solver->update("11-22,9x-115,998-1012"));
+    REQUIRE(solver->text() == input);
+    REQUIRE(solver->answer(1) == before);
+    REQUIRE(solver->apply({0, 0, ""}) == 0);
+}
+
+TEST_CASE("Incremental: Watcher - Re-solves Changed Files", "[incremental][integration]") {
+    // Arrange
+    const auto path = std::filesystem::temp_directory_path() / "aoc2025_watch_day3.txt";
+    const std::string input = generated(3, 8 << 10);
+    std::ofstream(path, std::ios::binary) << input;
+    aoc2025::Watcher watcher({{&Day3::Day3, path}});
+
+    // Act
+    const auto first = watcher.poll();
+    const auto unchanged = watcher.poll();
+    const std::string edited = input + "987654321111111\n";
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << edited;
+    std::filesystem::last_write_time(path, std::filesystem::last_write_time(path) + std::chrono::seconds(1));
+    const auto changed = watcher.poll();
+
+    // Assert
+    REQUIRE(first.size() == 1);
+    REQUIRE(first[0].error.empty());
+    REQUIRE(first[0].answers[0] == Day3::Day3.solve(1, input));
+    REQUIRE(unchanged.empty());
+    REQUIRE(changed.size() == 1);
+    REQUIRE(changed[0].records == 1);
+    REQUIRE(changed[0].answers[1] == Day3::Day3.solve(2, edited));
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Incremental: Watcher - Reports A Bad Version As Failed", "[incremental][integration]") {
+    // Arrange
+    const auto path = std::filesystem::temp_directory_path() / "aoc2025_watch_day2.txt";
+    const std::string good = "11-22,95-115,998-1012";
+    std::ofstream(path, std::ios::binary) << "11-22,9x-115";
+    aoc2025::Watcher watcher({{&Day2::Day2, path}});
+    auto rewrite = [&path](const std::string& contents) {
+        const auto modified = std::filesystem::last_write_time(path);
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << contents;
+        std::filesystem::last_write_time(path, modified + std::chrono::seconds(1));
+    };
+
+    // Act
+    const auto bad_first = watcher.poll();
+    rewrite(good);
+    const auto fixed = watcher.poll();
+    rewrite(good + ",x");
+    const auto broken = watcher.poll();
+    rewrite(good);
+    const auto restored = watcher.poll();
+    std::ostringstream out;
+    std::ostringstream err;
+    aoc2025::print_update(out, err, broken[0], false);
+
+    // Assert
+    REQUIRE_FALSE(bad_first[0].error.empty());
+    REQUIRE_FALSE(bad_first[0].answers[0].has_value());
+    REQUIRE_FALSE(bad_first[0].answers[1].has_value());
+    REQUIRE(fixed[0].error.empty());
+    REQUIRE(fixed[0].answers[0] == Day2::Day2.solve(1, good));
+    REQUIRE_FALSE(broken[0].error.empty());
+    REQUIRE_FALSE(broken[0].answers[0].has_value());
+    REQUIRE(out.str() == "Day 2:\n  Part 1: failed\n  Part 2: failed\n\n");
+    REQUIRE(restored[0].error.empty());
+    REQUIRE(restored[0].answers[0] == Day2::Day2.solve(1, good));
+    REQUIRE(restored[0].answers[1] == Day2::Day2.solve(2, good));
+    std::filesystem::remove(path);
+}
+
+} // namespace incremental_tests
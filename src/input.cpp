@@ -0,0 +1,174 @@
+#include "input.hpp"
+#include "compression.hpp"
+#include "trace.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AOC2025_HAVE_MMAP 1
+#else
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#endif
+
+namespace aoc2025 {
+    Input::Input(std::string contents) : owned_(std::move(contents)) {
+        data_ = owned_.data();
+        size_ = owned_.size();
+    }
+
+    Input Input::borrow(std::string_view contents) {
+        Input input;
+        input.data_ = contents.data();
+        input.size_ = contents.size();
+        input.borrowed_ = true;
+        return input;
+    }
+
+    Input::~Input() {
+        release();
+    }
+
+    Input::Input(Input&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    Input& Input::operator=(Input&& other) noexcept {
+        if (this != &other) {
+            release();
+            mapping_ = std::exchange(other.mapping_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            borrowed_ = std::exchange(other.borrowed_, false);
+            owned_ = std::move(other.owned_);
+            // A moved std::string may relocate its characters (small strings
+            // live inline), so owned text is re-pointed after the move
+            data_ = mapping_ != nullptr || borrowed_ ? other.data_ : owned_.data();
+            other.data_ = nullptr;
+            other.owned_.clear();
+        }
+        return *this;
+    }
+
+    // gzip and zstd files are inflated into an owned buffer, so solvers never
+    // see the difference
+    Input Input::decompressed(Input input) {
+        const compression::Format format = compression::detect(input.view());
+        if (format == compression::Format::kNone) {
+            return input;
+        }
+        return Input(compression::decompress(format, input.view()));
+    }
+
+    Input Input::open(const std::string& path) {
+        return decompressed(open_raw(path));
+    }
+
+    void Input::release() {
+#ifdef AOC2025_HAVE_MMAP
+        if (mapping_ != nullptr) {
+            ::munmap(mapping_, size_);
+        }
+#endif
+        mapping_ = nullptr;
+        data_ = nullptr;
+        size_ = 0;
+        borrowed_ = false;
+    }
+
+#ifdef AOC2025_HAVE_MMAP
+    namespace {
+        std::runtime_error io_error(const std::string& what, const std::string& path) {
+            return std::runtime_error(what + " " + path + ": " + std::strerror(errno));
+        }
+
+        // read() until EOF, for pipes and files whose size fstat cannot tell
+        std::string read_all(int fd, const std::string& path) {
+            std::string contents;
+            std::size_t capacity = 1 << 16;
+            for (;;) {
+                const std::size_t used = contents.size();
+                contents.resize(used + capacity);
+                const ssize_t count = ::read(fd, contents.data() + used, capacity);
+                if (count < 0) {
+                    if (errno == EINTR) {
+                        contents.resize(used);
+                        continue;
+                    }
+                    throw io_error("Error reading", path);
+                }
+                contents.resize(used + static_cast<std::size_t>(count));
+                if (count == 0) {
+                    return contents;
+                }
+                if (capacity < (std::size_t{1} << 24)) {
+                    capacity *= 2;
+                }
+            }
+        }
+    }
+
+    Input Input::open_raw(const std::string& path) {
+        AOC2025_TRACE_ZONE("input/open");
+        const bool is_stdin = path == "-";
+        const int fd = is_stdin ? STDIN_FILENO : ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw io_error("Error opening", path);
+        }
+
+        Input input;
+        struct stat info {};
+        if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+            const auto size = static_cast<std::size_t>(info.st_size);
+            void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping != MAP_FAILED) {
+                ::madvise(mapping, size, MADV_SEQUENTIAL);
+                ::madvise(mapping, size, MADV_WILLNEED);
+                input.mapping_ = mapping;
+                input.data_ = static_cast<const char*>(mapping);
+                input.size_ = size;
+            }
+        }
+
+        if (input.mapping_ == nullptr) {
+            try {
+                input = Input(read_all(fd, path));
+            } catch (...) {
+                if (!is_stdin) {
+                    ::close(fd);
+                }
+                throw;
+            }
+        }
+
+        AOC2025_TRACE_COUNTER("input_bytes", input.size());
+
+        // The mapping stays valid after the descriptor is closed
+        if (!is_stdin) {
+            ::close(fd);
+        }
+        return input;
+    }
+#else
+    Input Input::open_raw(const std::string& path) {
+        std::ostringstream contents;
+        if (path == "-") {
+            contents << std::cin.rdbuf();
+        } else {
+            std::ifstream file(path, std::ios::binary);
+            if (!file.is_open()) {
+                throw std::runtime_error("Error opening " + path);
+            }
+            contents << file.rdbuf();
+        }
+        return Input(std::move(contents).str());
+    }
+#endif
+}
@@ -0,0 +1,104 @@
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "input.hpp"
+
+namespace input_tests {
+
+static std::filesystem::path write_temp_file(const std::string& name, const std::string& contents) {
+    const auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream file(path, std::ios::binary);
+    file << contents;
+    return path;
+}
+
+TEST_CASE("Input: Open - Regular File", "[input][component]") {
+    // Arrange
+    const auto path = write_temp_file("aoc2025_input_regular.txt", "L68\nL30\nR48\n");
+    
+    // Act
+    aoc2025::Input input = aoc2025::Input::open(path.string());
+    
+    // Assert
+    REQUIRE(input.view() == "L68\nL30\nR48\n");
+    REQUIRE(input.size() == 12);
+#if defined(__unix__) || defined(__APPLE__)
+    REQUIRE(input.is_mapped());
+#endif
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Input: Open - Empty File", "[input][component]") {
+    // Arrange
+    const auto path = write_temp_file("aoc2025_input_empty.txt", "");
+    
+    // Act
+    aoc2025::Input input = aoc2025::Input::open(path.string());
+    
+    // Assert
+    REQUIRE(input.empty());
+    REQUIRE_FALSE(input.is_mapped());
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Input: Open - Missing File", "[input][component]") {
+    // Assert
+    REQUIRE_THROWS_AS(aoc2025::Input::open("aoc2025_does_not_exist/data.txt"), std::runtime_error);
+}
+
+#ifdef __linux__
+TEST_CASE("Input: Open - Unsized File Falls Back To Read", "[input][component]") {
+    // Act: procfs reports size 0 for files that do have content
+    aoc2025::Input input = aoc2025::Input::open("/proc/self/status");
+    
+    // Assert
+    REQUIRE_FALSE(input.is_mapped());
+    REQUIRE(input.view().find("Name:") != std::string_view::npos);
+}
+#endif
+
+TEST_CASE("Input: Move - Keeps View Valid", "[input][component]") {
+    // Arrange
+    aoc2025::Input original(std::string("11-22,95-115"));
+    
+    // Act
+    aoc2025::Input moved = std::move(original);
+    
+    // Assert
+    REQUIRE(moved.view() == "11-22,95-115");
+    REQUIRE(original.empty());
+}
+
+TEST_CASE("Input: Borrow - Refers To Text Without Copying", "[input][component]") {
+    // Arrange
+    static constexpr std::string_view kText = "L68\nL30\n";
+    
+    // Act
+    aoc2025::Input input = aoc2025::Input::borrow(kText);
+    aoc2025::Input moved = std::move(input);
+    
+    // Assert
+    REQUIRE(moved.view().data() == kText.data());
+    REQUIRE(moved.size() == kText.size());
+    REQUIRE_FALSE(moved.is_mapped());
+}
+
+TEST_CASE("Input: Borrow - Move Assignment Over Owned Text", "[input][component]") {
+    // Arrange
+    static constexpr std::string_view kText = "L68\nL30\n";
+    aoc2025::Input input("11-22,95-115");
+    aoc2025::Input empty = aoc2025::Input::borrow(kText.substr(0, 0));
+
+    // Act
+    input = aoc2025::Input::borrow(kText);
+    aoc2025::Input moved = std::move(empty);
+
+    // Assert
+    REQUIRE(input.view().data() == kText.data());
+    REQUIRE(input.view() == kText);
+    REQUIRE(moved.view().data() == kText.data());
+    REQUIRE(moved.empty());
+}
+
+} // namespace input_tests
@@ -0,0 +1,100 @@
+#include "kernels.hpp"
+
+#if defined(__GNUC__) || defined(__clang__)
+#define AOC2025_ALWAYS_INLINE __attribute__((always_inline)) inline
+#else
+#define AOC2025_ALWAYS_INLINE inline
+#endif
+
+namespace aoc2025::kernels {
+    namespace {
+        // Portable bodies, written without early exits so they vectorise. They
+        // are forced inline into each tier below, so every copy is compiled
+        // for that tier's target.
+        AOC2025_ALWAYS_INLINE bool digits_from_text_body(const char* text, std::size_t size, std::uint8_t* out) {
+            std::uint8_t invalid = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                const auto digit = static_cast<std::uint8_t>(static_cast<std::uint8_t>(text[i]) - '0');
+                invalid |= static_cast<std::uint8_t>(digit > 9);
+                out[i] = digit;
+            }
+            return invalid == 0;
+        }
+
+        AOC2025_ALWAYS_INLINE std::uint8_t max_value_body(const std::uint8_t* data, std::size_t size) {
+            std::uint8_t best = 0;
+            for (std::size_t i = 0; i < size; ++i) {
+                best = data[i] > best ? data[i] : best;
+            }
+            return best;
+        }
+
+        struct Table {
+            cpu::Level level;
+            bool (*digits_from_text)(const char*, std::size_t, std::uint8_t*);
+            std::uint8_t (*max_value)(const std::uint8_t*, std::size_t);
+        };
+
+        bool digits_from_text_generic(const char* text, std::size_t size, std::uint8_t* out) {
+            return digits_from_text_body(text, size, out);
+        }
+
+        std::uint8_t max_value_generic(const std::uint8_t* data, std::size_t size) {
+            return max_value_body(data, size);
+        }
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define AOC2025_KERNEL_TIER(suffix, isa)                                                                  \
+        __attribute__((target(isa)))                                                                      \
+        bool digits_from_text_##suffix(const char* text, std::size_t size, std::uint8_t* out) {           \
+            return digits_from_text_body(text, size, out);                                                \
+        }                                                                                                 \
+        __attribute__((target(isa)))                                                                      \
+        std::uint8_t max_value_##suffix(const std::uint8_t* data, std::size_t size) {                     \
+            return max_value_body(data, size);                                                            \
+        }
+
+        AOC2025_KERNEL_TIER(sse42, "sse4.2")
+        AOC2025_KERNEL_TIER(avx2, "avx2")
+        // 256-bit vectors even here: with 100-digit lines, full 512-bit vectors
+        // spend most of their time in tails and measured slower than AVX2
+        AOC2025_KERNEL_TIER(avx512, "avx512f,avx512bw,prefer-vector-width=256")
+#undef AOC2025_KERNEL_TIER
+
+        Table resolve() {
+            switch (cpu::active()) {
+                case cpu::Level::kAvx512:
+                    return {cpu::Level::kAvx512, &digits_from_text_avx512, &max_value_avx512};
+                case cpu::Level::kAvx2:
+                    return {cpu::Level::kAvx2, &digits_from_text_avx2, &max_value_avx2};
+                case cpu::Level::kSse42:
+                    return {cpu::Level::kSse42, &digits_from_text_sse42, &max_value_sse42};
+                case cpu::Level::kGeneric:
+                    break;
+            }
+            return {cpu::Level::kGeneric, &digits_from_text_generic, &max_value_generic};
+        }
+#else
+        Table resolve() {
+            return {cpu::Level::kGeneric, &digits_from_text_generic, &max_value_generic};
+        }
+#endif
+
+        const Table& table() {
+            static const Table resolved = resolve();
+            return resolved;
+        }
+    }
+
+    bool digits_from_text(std::string_view text, std::uint8_t* out) {
+        return table().digits_from_text(text.data(), text.size(), out);
+    }
+
+    std::uint8_t max_value(const std::uint8_t* data, std::size_t size) {
+        return table().max_value(data, size);
+    }
+
+    cpu::Level level() {
+        return table().level;
+    }
+}
@@ -0,0 +1,81 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "cpu.hpp"
+#include "kernels.hpp"
+
+// ctest also runs these with AOC2025_CPU capped to each lower tier, so every
+// compiled variant is checked on machines that support it
+namespace kernels_tests {
+
+TEST_CASE("Cpu: Level - Names Round Trip", "[kernels][component]") {
+    for (const auto level : {aoc2025::cpu::Level::kGeneric, aoc2025::cpu::Level::kSse42,
+                             aoc2025::cpu::Level::kAvx2, aoc2025::cpu::Level::kAvx512}) {
+        // Act & Assert
+        REQUIRE(aoc2025::cpu::parse_level(aoc2025::cpu::name(level)) == level);
+    }
+    REQUIRE_FALSE(aoc2025::cpu::parse_level("sse9").has_value());
+}
+
+TEST_CASE("Cpu: Active - Never Above Detected", "[kernels][component]") {
+    // Act & Assert
+    REQUIRE(aoc2025::cpu::active() <= aoc2025::cpu::detected());
+    REQUIRE(aoc2025::kernels::level() == aoc2025::cpu::active());
+}
+
+TEST_CASE("Kernels: digits_from_text - Converts Every Length", "[kernels][component]") {
+    for (std::size_t size = 0; size <= 130; ++size) {
+        // Arrange
+        std::string text;
+        for (std::size_t i = 0; i < size; ++i) {
+            text.push_back(static_cast<char>('0' + (i * 7) % 10));
+        }
+        std::vector<std::uint8_t> digits(size);
+        
+        // Act
+        const bool valid = aoc2025::kernels::digits_from_text(text, digits.data());
+        
+        // Assert
+        REQUIRE(valid);
+        for (std::size_t i = 0; i < size; ++i) {
+            REQUIRE(digits[i] == (i * 7) % 10);
+        }
+    }
+}
+
+TEST_CASE("Kernels: digits_from_text - Rejects Any Non-Digit", "[kernels][component]") {
+    const std::string digits(100, '5');
+    for (const char bad : {'/', ':', ' ', '\r', '\0', '\xff'}) {
+        for (const std::size_t at : {std::size_t{0}, std::size_t{31}, std::size_t{64}, std::size_t{99}}) {
+            // Arrange
+            std::string text = digits;
+            text[at] = bad;
+            std::vector<std::uint8_t> out(text.size());
+            
+            // Act & Assert
+            REQUIRE_FALSE(aoc2025::kernels::digits_from_text(text, out.data()));
+        }
+    }
+}
+
+TEST_CASE("Kernels: max_value - Matches std::max_element", "[kernels][component]") {
+    // Arrange
+    std::vector<std::uint8_t> data(200);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<std::uint8_t>((i * 37 + 11) % 97);
+    }
+    
+    for (std::size_t offset = 0; offset < 3; ++offset) {
+        for (std::size_t size = 0; size + offset <= data.size(); size += 7) {
+            // Act
+            const std::uint8_t result = aoc2025::kernels::max_value(data.data() + offset, size);
+            
+            // Assert
+            const auto begin = data.begin() + static_cast<std::ptrdiff_t>(offset);
+            REQUIRE(result == (size == 0 ? 0 : *std::max_element(begin, begin + static_cast<std::ptrdiff_t>(size))));
+        }
+    }
+}
+
+} // namespace kernels_tests
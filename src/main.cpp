@@ -2,7 +2,18 @@
 #include <iostream>
 #include <string>
 #include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
 #include "aoc2025.hpp"
+#include "batch.hpp"
+#include "coordinator.hpp"
+#include "runner.hpp"
+#include "server.hpp"
+#include "size.hpp"
+#include "trace.hpp"
+#include "watch.hpp"
 
 // Forward declarations for day registrations
 namespace Day1 {
@@ -21,62 +32,168 @@ int main(int argc, char* argv[]) {
     aoc2025::register_day(Day2::Day2);
     aoc2025::register_day(Day3::Day3);
     
-    // Determine which days to run
-    std::vector<int> days_to_run;
+    aoc2025::RunOptions options;
+    std::string trace_path;
+    std::string serve_path;
+    std::vector<std::filesystem::path> serve_roots;
+    std::string shard_path;
+    aoc2025::ShardOptions shard;
+    aoc2025::BatchOptions batch;
+    bool watch = false;
     
-    if (argc > 1) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "-j" && i + 1 < argc) {
+            // Worker threads for loading and solving
+            options.threads = static_cast<unsigned>(std::max(1, std::atoi(argv[++i])));
+            continue;
+        }
+        if (arg == "--no-cache") {
+            options.cache_mode = aoc2025::CacheMode::kBypass;
+            continue;
+        }
+        if (arg == "--no-model-cache") {
+            // Always parse, neither reading nor writing .aocbin sidecars
+            options.model_cache = false;
+            continue;
+        }
+        if (arg == "--no-embedded") {
+            // Read dayN/data.txt even when inputs were compiled in
+            options.use_embedded = false;
+            continue;
+        }
+        if (arg == "--verify-cache") {
+            options.cache_mode = aoc2025::CacheMode::kVerify;
+            continue;
+        }
+        if (arg == "--trace" && i + 1 < argc) {
+            // Chrome/Perfetto trace of the whole run
+            trace_path = argv[++i];
+            continue;
+        }
+        if (arg == "--alloc") {
+            options.alloc_stats = true;
+            continue;
+        }
+        if (arg == "--perf") {
+            options.perf_counters = true;
+            continue;
+        }
+        if (arg == "--time") {
+            options.show_timings = true;
+            continue;
+        }
+        if (arg == "--batch" && i + 1 < argc) {
+            // Directory or manifest of many inputs, may repeat
+            batch.sources.emplace_back(argv[++i]);
+            continue;
+        }
+        if (arg == "--batch-memory" && i + 1 < argc) {
+            const std::string text = argv[++i];
+            batch.max_bytes_in_flight = aoc2025::parse_size(text);
+            if (batch.max_bytes_in_flight == 0) {
+                std::cerr << "Invalid --batch-memory: " << text << '\n';
+                return 1;
+            }
+            continue;
+        }
+        if (arg == "-o" && i + 1 < argc) {
+            batch.output_path = argv[++i];
+            continue;
+        }
+        if (arg == "--format" && i + 1 < argc) {
+            const std::string format = argv[++i];
+            if (format != "csv" && format != "json") {
+                std::cerr << "Unknown format: " << format << '\n';
+                return 1;
+            }
+            batch.format = format == "json" ? aoc2025::BatchFormat::kJson : aoc2025::BatchFormat::kCsv;
+            continue;
+        }
+        if (arg == "--serve" && i + 1 < argc) {
+            // Answer requests on a Unix socket until interrupted
+            serve_path = argv[++i];
+            continue;
+        }
+        if (arg == "--serve-root" && i + 1 < argc) {
+            // Directory whose files --connect coordinators may shard, may repeat
+            serve_roots.emplace_back(argv[++i]);
+            continue;
+        }
+        if (arg == "--shard" && i + 1 < argc) {
+            // Solve a single day from a file across worker processes
+            shard_path = argv[++i];
+            continue;
+        }
+        if (arg == "--connect" && i + 1 < argc) {
+            // Shard to a running --serve daemon instead of forking, may repeat
+            shard.endpoints.emplace_back(argv[++i]);
+            continue;
+        }
+        if (arg == "--shard-timeout" && i + 1 < argc) {
+            // Seconds a worker may spend on one shard, 0 for no limit
+            const std::string text = argv[++i];
+            char* end = nullptr;
+            const double seconds = std::strtod(text.c_str(), &end);
+            if (text.empty() || *end != '\0' || !(seconds >= 0.0) || seconds > 1e6) {
+                std::cerr << "Invalid --shard-timeout: " << text << '\n';
+                return 1;
+            }
+            shard.shard_timeout = std::chrono::milliseconds(static_cast<std::int64_t>(seconds * 1000.0));
+            continue;
+        }
+        if (arg == "--watch") {
+            // Keep solving the inputs, re-solving only what changes
+            watch = true;
+            continue;
+        }
+        if (arg == "--stream" && i + 1 < argc) {
+            // Solve a single day from a file or stdin in chunks
+            options.stream_path = argv[++i];
+            continue;
+        }
+        if (arg == "--cache-dir" && i + 1 < argc) {
+            options.cache_directory = argv[++i];
+            continue;
+        }
         // Run specific day from command line argument
-        int day_number = std::atoi(argv[1]);
+        int day_number = std::atoi(argv[i]);
         if (day_number > 0) {
-            days_to_run.push_back(day_number);
+            options.days.push_back(day_number);
         } else {
-            std::cerr << "Invalid day number: " << argv[1] << '\n';
+            std::cerr << "Invalid day number: " << argv[i] << '\n';
             return 1;
         }
-    } else {
-        // Run all registered days
-        for (const auto& [day_num, _] : aoc2025::days) {
-            days_to_run.push_back(day_num);
-        }
     }
     
-    // Run each day
-    for (int day_number : days_to_run) {
-        auto it = aoc2025::days.find(day_number);
-        if (it == aoc2025::days.end()) {
-            std::cerr << "Day " << day_number << " not implemented yet\n";
-            continue;
-        }
-        
-        const auto& day = it->second;
-        
-        // Check if input file exists
-        if (!day.has_input()) {
-            std::cerr << "Error reading file " << day.get_input_file() << ": file not found\n";
-            continue;
-        }
-        
-        // Read input
-        std::string input = day.read_input();
-        
-        // Run parts
-        std::cout << "Day " << day_number << ":\n";
-        
-        // Part 1
-        std::ostringstream part1_oss;
-        day.part1(part1_oss, input);
-        std::cout << "  Part 1: " << part1_oss.str() << '\n';
-        
-        // Part 2 (if unlocked)
-        if (day.part2.has_value()) {
-            std::ostringstream part2_oss;
-            day.part2.value()(part2_oss, input);
-            std::cout << "  Part 2: " << part2_oss.str() << '\n';
-        } else {
-            std::cout << "  Part 2: Not yet unlocked\n";
+    if (!trace_path.empty()) {
+        if (!AOC2025_TRACING) {
+            std::cerr << "Tracing is not compiled in, reconfigure with -DAOC2025_ENABLE_TRACING=ON\n";
         }
-        std::cout << '\n';
+        aoc2025::trace::set_enabled(true);
+        AOC2025_TRACE_THREAD("main");
+    }
+    
+    int result = 0;
+    if (!batch.sources.empty()) {
+        batch.days = options.days;
+        batch.threads = options.threads;
+        result = aoc2025::run_batch(batch, std::cout, std::cerr);
+    } else if (!shard_path.empty()) {
+        shard.workers = options.threads;
+        result = aoc2025::run_sharded(options, shard_path, shard, std::cout, std::cerr);
+    } else if (watch) {
+        result = aoc2025::watch({options.days, std::chrono::milliseconds(200), options.show_timings},
+                                std::cout, std::cerr);
+    } else if (!serve_path.empty()) {
+        result = aoc2025::serve({serve_path, options.threads, serve_roots}, std::cerr);
+    } else {
+        AOC2025_TRACE_ZONE("main");
+        result = aoc2025::run(options, std::cout, std::cerr);
     }
     
-    return 0;
-}
\ No newline at end of file
+    if (!trace_path.empty() && AOC2025_TRACING && !aoc2025::trace::write_chrome_json(trace_path)) {
+        std::cerr << "Error writing trace " << trace_path << '\n';
+    }
+    return result;
+}
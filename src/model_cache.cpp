@@ -0,0 +1,146 @@
+#include "model_cache.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <system_error>
+
+#include "binary.hpp"
+#include "input.hpp"
+#include "trace.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace aoc2025 {
+    namespace {
+        constexpr std::string_view kMagic{"AOCBIN\0\0", 8};
+    }
+
+    std::optional<SidecarKey> SidecarKey::for_file(const Day& day, const std::filesystem::path& input,
+                                                   std::uint64_t input_hash) {
+        std::error_code error;
+        if (!std::filesystem::is_regular_file(input, error)) {
+            return std::nullopt;
+        }
+        const auto size = std::filesystem::file_size(input, error);
+        if (error) {
+            return std::nullopt;
+        }
+        const auto mtime = std::filesystem::last_write_time(input, error);
+        if (error) {
+            return std::nullopt;
+        }
+        SidecarKey key;
+        key.day_number = day.day_number;
+        key.solver_version = day.version;
+        key.input_size = size;
+        key.input_mtime = std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch()).count();
+        key.input_hash = input_hash;
+        return key;
+    }
+
+    namespace sidecar {
+        std::filesystem::path path_for(const std::filesystem::path& input) {
+            std::filesystem::path path = input;
+            path += ".aocbin";
+            return path;
+        }
+
+        bool is_sidecar(const std::filesystem::path& path) {
+            const std::string name = path.filename().string();
+            return name.ends_with(".aocbin") || name.find(".aocbin.tmp") != std::string::npos;
+        }
+
+        std::string encode(const SidecarKey& key, std::string_view model_bytes) {
+            std::string out;
+            out.reserve(64 + key.solver_version.size() + model_bytes.size());
+            binary::Writer writer(out);
+            writer.put_bytes(kMagic);
+            writer.put_u32(kFormatVersion);
+            writer.put_u32(static_cast<std::uint32_t>(key.day_number));
+            writer.put_u32(static_cast<std::uint32_t>(key.solver_version.size()));
+            writer.put_bytes(key.solver_version);
+            writer.put_u64(key.input_size);
+            writer.put_i64(key.input_mtime);
+            writer.put_u64(key.input_hash);
+            writer.put_u64(model_bytes.size());
+            writer.put_bytes(model_bytes);
+            return out;
+        }
+
+        std::optional<std::string_view> decode(std::string_view file, const SidecarKey& key) {
+            try {
+                binary::Reader reader(file);
+                if (reader.get_bytes(kMagic.size()) != kMagic || reader.get_u32() != kFormatVersion) {
+                    return std::nullopt;
+                }
+                SidecarKey stored;
+                stored.day_number = static_cast<int>(reader.get_u32());
+                stored.solver_version = std::string(reader.get_bytes(reader.get_u32()));
+                stored.input_size = reader.get_u64();
+                stored.input_mtime = reader.get_i64();
+                stored.input_hash = reader.get_u64();
+                const std::uint64_t size = reader.get_u64();
+                if (stored != key || size != reader.remaining()) {
+                    return std::nullopt;
+                }
+                return reader.get_bytes(static_cast<std::size_t>(size));
+            } catch (const std::runtime_error&) {
+                return std::nullopt;
+            }
+        }
+
+        Day::Model load(const Day& day, const std::filesystem::path& input, const SidecarKey& key) {
+            AOC2025_TRACE_ZONE("sidecar/load", day.day_number);
+            const std::filesystem::path path = path_for(input);
+            std::error_code error;
+            if (!day.has_binary_model() || !std::filesystem::is_regular_file(path, error)) {
+                return nullptr;
+            }
+            try {
+                // The model is copied into its own arena, so the mapping can go
+                const Input file = Input::open(path.string());
+                const std::optional<std::string_view> model_bytes = decode(file.view(), key);
+                return model_bytes ? day.load_model(*model_bytes) : nullptr;
+            } catch (const std::exception&) {
+                return nullptr;
+            }
+        }
+
+        bool store(const Day& day, const std::filesystem::path& input, const SidecarKey& key,
+                   const Day::Model& model) {
+            AOC2025_TRACE_ZONE("sidecar/store", day.day_number);
+            if (!day.has_binary_model() || !model) {
+                return false;
+            }
+            const std::string contents = encode(key, day.save_model(model));
+            const std::filesystem::path target = path_for(input);
+            std::filesystem::path temporary = target;
+#if defined(__unix__) || defined(__APPLE__)
+            temporary += ".tmp." + std::to_string(::getpid());
+#else
+            temporary += ".tmp";
+#endif
+            std::error_code error;
+            {
+                std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+                if (!file.is_open()) {
+                    return false;
+                }
+                file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+                if (!file.good()) {
+                    file.close();
+                    std::filesystem::remove(temporary, error);
+                    return false;
+                }
+            }
+            std::filesystem::rename(temporary, target, error);
+            if (error) {
+                std::filesystem::remove(temporary, error);
+                return false;
+            }
+            return true;
+        }
+    }
+}
@@ -0,0 +1,123 @@
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "binary.hpp"
+#include "day1.hpp"
+#include "day2.hpp"
+#include "day3.hpp"
+#include "hash.hpp"
+#include "model_cache.hpp"
+
+namespace model_cache_tests {
+
+static std::filesystem::path write_input(const std::string& name, const std::string& contents) {
+    const auto directory = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const auto path = directory / "data.txt";
+    std::ofstream(path, std::ios::binary) << contents;
+    return path;
+}
+
+static aoc2025::SidecarKey key_for(const aoc2025::Day& day, const std::filesystem::path& input,
+                                   const std::string& contents) {
+    return aoc2025::SidecarKey::for_file(day, input, aoc2025::hash_bytes(contents)).value();
+}
+
+TEST_CASE("Binary: Reader - Reads What Writer Wrote", "[sidecar][component]") {
+    // Arrange
+    std::string bytes;
+    aoc2025::binary::Writer writer(bytes);
+    writer.put_u8(7);
+    writer.put_u16(0x0506);
+    writer.put_u32(0x01020304);
+    writer.put_i64(-5);
+    writer.put_bytes("xyz");
+    
+    // Act
+    aoc2025::binary::Reader reader(bytes);
+    
+    // Assert
+    REQUIRE(bytes.substr(1, 6) == std::string("\x06\x05\x04\x03\x02\x01", 6));
+    REQUIRE(reader.get_u8() == 7);
+    REQUIRE(reader.get_u16() == 0x0506);
+    REQUIRE(reader.get_u32() == 0x01020304);
+    REQUIRE(reader.get_i64() == -5);
+    REQUIRE(reader.get_bytes(3) == "xyz");
+    REQUIRE(reader.at_end());
+    REQUIRE_THROWS_AS(reader.get_u8(), std::runtime_error);
+}
+
+TEST_CASE("Sidecar: Store - Loads Without Parsing", "[sidecar][component]") {
+    // Arrange
+    const std::string contents = "987654321111111\n123456789\n999888777\n";
+    const auto input = write_input("aoc2025_sidecar_roundtrip", contents);
+    const auto key = key_for(Day3::Day3, input, contents);
+    const auto parsed = Day3::Day3.parse_model(contents);
+    
+    // Act
+    const bool stored = aoc2025::sidecar::store(Day3::Day3, input, key, parsed);
+    const aoc2025::Day::Model loaded = aoc2025::sidecar::load(Day3::Day3, input, key);
+    
+    // Assert
+    REQUIRE(stored);
+    REQUIRE(std::filesystem::exists(aoc2025::sidecar::path_for(input)));
+    REQUIRE(loaded != nullptr);
+    REQUIRE(Day3::Day3.solve_parsed(1, loaded) == Day3::Day3.solve_parsed(1, parsed));
+    REQUIRE(Day3::Day3.solve_parsed(2, loaded) == Day3::Day3.solve_parsed(2, parsed));
+    std::filesystem::remove_all(input.parent_path());
+}
+
+TEST_CASE("Sidecar: Load - Miss When Input Changed", "[sidecar][component]") {
+    // Arrange
+    const std::string contents = "L68\nL30\nR48\n";
+    const auto input = write_input("aoc2025_sidecar_stale", contents);
+    const auto key = key_for(Day1::Day1, input, contents);
+    REQUIRE(aoc2025::sidecar::store(Day1::Day1, input, key, Day1::Day1.parse_model(contents)));
+    
+    aoc2025::SidecarKey other_size = key;
+    other_size.input_size += 1;
+    aoc2025::SidecarKey other_mtime = key;
+    other_mtime.input_mtime += 1;
+    aoc2025::SidecarKey other_hash = key;
+    other_hash.input_hash ^= 1;
+    aoc2025::SidecarKey other_version = key;
+    other_version.solver_version += "x";
+    
+    // Act & Assert
+    REQUIRE(aoc2025::sidecar::load(Day1::Day1, input, key) != nullptr);
+    REQUIRE(aoc2025::sidecar::load(Day1::Day1, input, other_size) == nullptr);
+    REQUIRE(aoc2025::sidecar::load(Day1::Day1, input, other_mtime) == nullptr);
+    REQUIRE(aoc2025::sidecar::load(Day1::Day1, input, other_hash) == nullptr);
+    REQUIRE(aoc2025::sidecar::load(Day1::Day1, input, other_version) == nullptr);
+    std::filesystem::remove_all(input.parent_path());
+}
+
+TEST_CASE("Sidecar: Load - Miss On Corrupt Or Truncated File", "[sidecar][component]") {
+    // Arrange
+    const std::string contents = "11-22,95-115,998-1012";
+    const auto input = write_input("aoc2025_sidecar_corrupt", contents);
+    const auto key = key_for(Day2::Day2, input, contents);
+    const std::string file = aoc2025::sidecar::encode(key, Day2::Day2.save_model(Day2::Day2.parse_model(contents)));
+    
+    // Act & Assert
+    REQUIRE(aoc2025::sidecar::decode(file, key).has_value());
+    for (std::size_t size = 0; size < file.size(); size += 5) {
+        std::ofstream(aoc2025::sidecar::path_for(input), std::ios::binary | std::ios::trunc) << file.substr(0, size);
+        REQUIRE(aoc2025::sidecar::load(Day2::Day2, input, key) == nullptr);
+    }
+    // A last range of 9-1, which the parser would have rejected
+    std::string inverted = file;
+    inverted.replace(inverted.size() - 16, 16, std::string("\x09\0\0\0\0\0\0\0\x01\0\0\0\0\0\0\0", 16));
+    std::ofstream(aoc2025::sidecar::path_for(input), std::ios::binary | std::ios::trunc) << inverted;
+    REQUIRE(aoc2025::sidecar::load(Day2::Day2, input, key) == nullptr);
+    std::filesystem::remove_all(input.parent_path());
+}
+
+TEST_CASE("Sidecar: Key - None For Missing File", "[sidecar][component]") {
+    // Act & Assert
+    REQUIRE_FALSE(aoc2025::SidecarKey::for_file(Day1::Day1, "/nonexistent/aoc2025/data.txt", 0).has_value());
+}
+
+} // namespace model_cache_tests
@@ -0,0 +1,154 @@
+#include "perf_counters.hpp"
+
+#include <iomanip>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace aoc2025 {
+#ifdef __linux__
+    namespace {
+        struct EventConfig {
+            std::uint32_t type;
+            std::uint64_t config;
+        };
+
+        constexpr std::uint64_t cache_event(std::uint64_t cache, std::uint64_t op, std::uint64_t result) {
+            return cache | (op << 8) | (result << 16);
+        }
+
+        constexpr std::array<EventConfig, static_cast<std::size_t>(PerfEvent::kCount)> kEvents{{
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HW_CACHE, cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS)},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+        }};
+
+        int open_event(const EventConfig& event) {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+            attr.size = sizeof(attr);
+            attr.type = event.type;
+            attr.config = event.config;
+            attr.disabled = 1;
+            // User space only, which is all perf_event_paranoid=2 allows
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            // pid 0, cpu -1: this thread on whichever CPU it runs
+            return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        }
+    }
+
+    PerfCounters::PerfCounters() {
+        for (std::size_t i = 0; i < fds_.size(); ++i) {
+            fds_[i] = open_event(kEvents[i]);
+        }
+    }
+
+    PerfCounters::~PerfCounters() {
+        for (const int fd : fds_) {
+            if (fd >= 0) {
+                ::close(fd);
+            }
+        }
+    }
+
+    bool PerfCounters::available() const {
+        for (const int fd : fds_) {
+            if (fd >= 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void PerfCounters::start() {
+        for (const int fd : fds_) {
+            if (fd >= 0) {
+                ::ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ::ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+    }
+
+    PerfSample PerfCounters::stop() {
+        PerfSample sample;
+        for (const int fd : fds_) {
+            if (fd >= 0) {
+                ::ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+        for (std::size_t i = 0; i < fds_.size(); ++i) {
+            std::uint64_t value = 0;
+            if (fds_[i] >= 0 && ::read(fds_[i], &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value))) {
+                sample.values[i] = value;
+            }
+        }
+        return sample;
+    }
+#else
+    PerfCounters::PerfCounters() {
+        fds_.fill(-1);
+    }
+
+    PerfCounters::~PerfCounters() = default;
+
+    bool PerfCounters::available() const {
+        return false;
+    }
+
+    void PerfCounters::start() {}
+
+    PerfSample PerfCounters::stop() {
+        return {};
+    }
+#endif
+
+    namespace {
+        void print_count(std::ostream& os, std::uint64_t value) {
+            const double number = static_cast<double>(value);
+            if (value >= 1000000000) {
+                os << std::setprecision(2) << number / 1e9 << 'G';
+            } else if (value >= 1000000) {
+                os << std::setprecision(2) << number / 1e6 << 'M';
+            } else if (value >= 1000) {
+                os << std::setprecision(1) << number / 1e3 << 'K';
+            } else {
+                os << value;
+            }
+        }
+    }
+
+    void print_perf_sample(std::ostream& os, const PerfSample& sample) {
+        static constexpr std::array<const char*, static_cast<std::size_t>(PerfEvent::kCount)> kNames{
+            "cycles", "instructions", "L1d misses", "LLC misses", "branch misses", "page faults"};
+
+        const auto flags = os.flags();
+        const auto precision = os.precision();
+        os << std::fixed;
+        bool first = true;
+        for (std::size_t i = 0; i < kNames.size(); ++i) {
+            if (!sample.values[i]) {
+                continue;
+            }
+            os << (first ? "" : ", ") << kNames[i] << ' ';
+            print_count(os, *sample.values[i]);
+            first = false;
+            if (static_cast<PerfEvent>(i) == PerfEvent::kInstructions && sample.ipc()) {
+                os << ", IPC " << std::setprecision(2) << *sample.ipc();
+            }
+        }
+        if (first) {
+            os << "counters unavailable";
+        }
+        os.flags(flags);
+        os.precision(precision);
+    }
+}
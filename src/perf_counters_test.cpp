@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+#include "perf_counters.hpp"
+
+namespace perf_counters_tests {
+
+TEST_CASE("PerfSample: IPC - From Cycles And Instructions", "[perf][component]") {
+    // Arrange
+    aoc2025::PerfSample sample;
+    sample.values[static_cast<std::size_t>(aoc2025::PerfEvent::kCycles)] = 1000;
+    sample.values[static_cast<std::size_t>(aoc2025::PerfEvent::kInstructions)] = 2500;
+    
+    // Assert
+    REQUIRE(sample.ipc() == 2.5);
+    REQUIRE(sample.any());
+}
+
+TEST_CASE("PerfSample: Print - Skips Missing Events", "[perf][component]") {
+    // Arrange
+    aoc2025::PerfSample sample;
+    sample.values[static_cast<std::size_t>(aoc2025::PerfEvent::kPageFaults)] = 12;
+    std::ostringstream oss;
+    
+    // Act
+    aoc2025::print_perf_sample(oss, sample);
+    
+    // Assert
+    REQUIRE(oss.str() == "page faults 12");
+}
+
+TEST_CASE("PerfSample: Print - Nothing Available", "[perf][component]") {
+    // Arrange
+    std::ostringstream oss;
+    
+    // Act
+    aoc2025::print_perf_sample(oss, aoc2025::PerfSample{});
+    
+    // Assert
+    REQUIRE(oss.str() == "counters unavailable");
+}
+
+TEST_CASE("PerfCounters: Start Stop - Degrades Gracefully", "[perf][component]") {
+    // Arrange
+    aoc2025::PerfCounters counters;
+    
+    // Act
+    counters.start();
+    volatile std::uint64_t sum = 0;
+    for (int i = 0; i < 100000; ++i) {
+        sum = sum + static_cast<std::uint64_t>(i);
+    }
+    const aoc2025::PerfSample sample = counters.stop();
+    
+    // Assert
+    REQUIRE(sample.any() == counters.available());
+}
+
+} // namespace perf_counters_tests
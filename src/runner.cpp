@@ -0,0 +1,482 @@
+#include "runner.hpp"
+
+#include <array>
+#include <chrono>
+#include <future>
+#include <iomanip>
+#include <memory>
+#include <string>
+
+#include "alloc_stats.hpp"
+#include "chunk_reader.hpp"
+#include "embedded.hpp"
+#include "hash.hpp"
+#include "model_cache.hpp"
+#include "perf_counters.hpp"
+#include "trace.hpp"
+
+namespace aoc2025 {
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        double elapsed_ms(Clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        struct PartResult {
+            Answer answer;
+            // Diagnostic for stderr, e.g. a cache mismatch found by --verify-cache
+            std::string note;
+            double solve_ms = 0.0;
+            bool cached = false;
+            // Computed during compilation from an embedded input
+            bool constant = false;
+            std::optional<PerfSample> perf;
+            std::optional<alloc::Stats> allocations;
+        };
+
+        // Everything the part tasks of one day share: the mapped input, its hash
+        // and, for days with a parse stage, the parsed model
+        struct Stage {
+            Input input;
+            std::uint64_t hash = 0;
+            Day::Model model;
+        };
+
+        struct DayJob {
+            int day_number;
+            const Day* day = nullptr;
+            // Written before loaded is satisfied, read after it
+            double load_ms = 0.0;
+            double parse_ms = 0.0;
+            bool model_from_sidecar = false;
+            // Set when a freshly parsed model was written to its sidecar
+            std::optional<double> store_ms;
+            std::optional<PerfSample> parse_perf;
+            std::optional<alloc::Stats> parse_allocations;
+            std::promise<void> loaded;
+            std::array<std::promise<PartResult>, 2> parts;
+        };
+
+        CacheKey cache_key(const Day& day, int part, const Stage& stage) {
+            return CacheKey{day.day_number, part, day.version, stage.hash, stage.input.size()};
+        }
+
+        PartResult solve_part(const RunOptions& options, const AnswerCache& cache, const Day& day,
+                              int part, const Stage& stage, const std::optional<std::string>& cached) {
+            AOC2025_TRACE_ZONE(part == 1 ? "runner/part1" : "runner/part2", day.day_number);
+            std::optional<PerfCounters> counters;
+            if (options.perf_counters) {
+                counters.emplace();
+                counters->start();
+            }
+            const alloc::Scope allocations;
+            const auto start = Clock::now();
+            PartResult result;
+            result.answer = stage.model ? day.solve_parsed(part, stage.model) : day.solve(part, stage.input.view());
+            result.solve_ms = elapsed_ms(start);
+            if (counters) {
+                result.perf = counters->stop();
+            }
+            if (options.alloc_stats) {
+                result.allocations = allocations.stop();
+            }
+
+            if (options.cache_mode == CacheMode::kBypass) {
+                return result;
+            }
+            const std::string solved = result.answer.to_string();
+            if (cached && *cached != solved) {
+                result.note = "cache mismatch: stored " + *cached + ", solved " + solved;
+            }
+            if ((!cached || *cached != solved) && !cache.store(cache_key(day, part, stage), solved)) {
+                result.note += (result.note.empty() ? "" : "; ") +
+                               std::string("could not write cache entry in ") + cache.directory().string();
+            }
+            return result;
+        }
+
+        // Load and hash the input, answer what the cache already knows, parse
+        // once if anything is left, then fan out one task per remaining part.
+        // The stage is released when the last of those tasks finishes.
+        void load_and_solve(ThreadPool& pool, const RunOptions& options, const AnswerCache& cache, DayJob& job) {
+            const Day& day = *job.day;
+            auto stage = std::make_shared<Stage>();
+            std::array<std::optional<std::string>, 2> cached;
+            std::vector<int> pending;
+            bool use_sidecar = false;
+
+            try {
+                const std::optional<std::string_view> embedded =
+                    options.use_embedded ? embedded::input(day.day_number) : std::nullopt;
+                if (!embedded && !day.has_input()) {
+                    throw std::runtime_error("Error reading file " + day.get_input_file() + ": file not found");
+                }
+                AOC2025_TRACE_ZONE("runner/load", day.day_number);
+                const auto load_start = Clock::now();
+                stage->input = embedded ? Input::borrow(*embedded) : day.read_input();
+                // Sidecars are validated by the input hash as well as its size and mtime
+                use_sidecar = options.model_cache && !embedded && day.has_binary_model();
+                if (options.cache_mode != CacheMode::kBypass || use_sidecar) {
+                    AOC2025_TRACE_ZONE("runner/hash", day.day_number);
+                    stage->hash = hash_bytes(stage->input.view());
+                }
+                job.load_ms = elapsed_ms(load_start);
+
+                for (int part = 1; part <= 2; ++part) {
+                    if (!day.has_part(part)) {
+                        continue;
+                    }
+                    if (embedded) {
+                        if (std::optional<Answer> answer = embedded::answer(day.day_number, part)) {
+                            PartResult constant;
+                            constant.answer = std::move(*answer);
+                            constant.constant = true;
+                            job.parts[part - 1].set_value(std::move(constant));
+                            continue;
+                        }
+                    }
+                    if (options.cache_mode != CacheMode::kBypass) {
+                        cached[part - 1] = cache.load(cache_key(day, part, *stage));
+                    }
+                    if (cached[part - 1] && options.cache_mode == CacheMode::kUse) {
+                        PartResult hit;
+                        hit.answer = Answer::parse(*cached[part - 1]);
+                        hit.cached = true;
+                        AOC2025_TRACE_COUNTER("cache_hits", 1);
+                        job.parts[part - 1].set_value(std::move(hit));
+                    } else {
+                        pending.push_back(part);
+                    }
+                }
+
+            } catch (...) {
+                job.loaded.set_exception(std::current_exception());
+                return;
+            }
+
+            // A model that fails to build fails the parts that needed it; parts
+            // already answered from the cache or at compile time keep their answers
+            try {
+                if (!pending.empty() && day.has_parse_stage()) {
+                    AOC2025_TRACE_ZONE("runner/parse", day.day_number);
+                    std::optional<PerfCounters> counters;
+                    if (options.perf_counters) {
+                        counters.emplace();
+                        counters->start();
+                    }
+                    const alloc::Scope allocations;
+                    const auto parse_start = Clock::now();
+                    const std::optional<SidecarKey> key =
+                        use_sidecar ? SidecarKey::for_file(day, day.get_input_file(), stage->hash) : std::nullopt;
+                    if (key) {
+                        stage->model = sidecar::load(day, day.get_input_file(), *key);
+                        job.model_from_sidecar = stage->model != nullptr;
+                    }
+                    const bool parsed = !stage->model;
+                    if (parsed) {
+                        stage->model = day.parse_model(stage->input.view());
+                    }
+                    job.parse_ms = elapsed_ms(parse_start);
+                    if (counters) {
+                        job.parse_perf = counters->stop();
+                    }
+                    if (options.alloc_stats) {
+                        job.parse_allocations = allocations.stop();
+                    }
+                    // Timed on its own: the write is a one-off cost of the
+                    // first run, not part of parsing
+                    if (parsed && key) {
+                        const auto store_start = Clock::now();
+                        sidecar::store(day, day.get_input_file(), *key, stage->model);
+                        job.store_ms = elapsed_ms(store_start);
+                    }
+                }
+            } catch (...) {
+                for (const int part : pending) {
+                    job.parts[part - 1].set_exception(std::current_exception());
+                }
+                pending.clear();
+            }
+            job.loaded.set_value();
+
+            for (const int part : pending) {
+                pool.submit([&options, &cache, &job, stage, part, cached = cached[part - 1]]() {
+                    try {
+                        job.parts[part - 1].set_value(solve_part(options, cache, *job.day, part, *stage, cached));
+                    } catch (...) {
+                        job.parts[part - 1].set_exception(std::current_exception());
+                    }
+                });
+            }
+        }
+
+        // False when the part failed
+        bool print_part(std::ostream& out, std::ostream& err, const RunOptions& options, int day_number, int part,
+                        std::future<PartResult>& result) {
+            try {
+                const PartResult value = result.get();
+                out << "  Part " << part << ": " << value.answer;
+                if (options.show_timings) {
+                    if (value.cached) {
+                        out << "  (cached)";
+                    } else if (value.constant) {
+                        out << "  (compile time)";
+                    } else {
+                        out << "  (" << std::fixed << std::setprecision(3) << value.solve_ms << " ms)";
+                    }
+                }
+                out << '\n';
+                if (value.perf) {
+                    out << "    ";
+                    print_perf_sample(out, *value.perf);
+                    out << '\n';
+                }
+                if (value.allocations) {
+                    out << "    ";
+                    alloc::print_stats(out, *value.allocations);
+                    out << '\n';
+                }
+                if (!value.note.empty()) {
+                    err << "Day " << day_number << " part " << part << ": " << value.note << '\n';
+                }
+                return true;
+            } catch (const std::exception& error) {
+                out << "  Part " << part << ": failed\n";
+                err << "Day " << day_number << " part " << part << ": " << error.what() << '\n';
+                return false;
+            }
+        }
+
+        // Feed one day's solvers chunk by chunk while a reader thread fetches
+        // the next chunks. A part whose solver throws is reported as failed
+        // without stopping the other, and the run returns 2.
+        int run_stream(const RunOptions& options, std::ostream& out, std::ostream& err) {
+            if (options.days.size() != 1) {
+                err << "--stream needs exactly one day\n";
+                return 1;
+            }
+            const int day_number = options.days.front();
+            const auto it = days.find(day_number);
+            if (it == days.end()) {
+                err << "Day " << day_number << " not implemented yet\n";
+                return 1;
+            }
+            const Day& day = it->second;
+            if (!day.has_stream()) {
+                err << "Day " << day_number << " does not support streaming\n";
+                return 1;
+            }
+
+            std::array<std::unique_ptr<StreamSolver>, 2> solvers;
+            std::array<std::exception_ptr, 2> errors;
+            for (int part = 1; part <= 2; ++part) {
+                if (day.has_part(part)) {
+                    solvers[part - 1] = day.stream(part);
+                }
+            }
+
+            auto for_each_solver = [&](auto&& fn) {
+                for (std::size_t i = 0; i < solvers.size(); ++i) {
+                    if (!solvers[i] || errors[i]) {
+                        continue;
+                    }
+                    try {
+                        fn(i, *solvers[i]);
+                    } catch (...) {
+                        errors[i] = std::current_exception();
+                    }
+                }
+            };
+
+            // Both parts consume each chunk in turn, so counters cover the
+            // whole stream rather than each part
+            std::optional<PerfCounters> counters;
+            if (options.perf_counters) {
+                counters.emplace();
+                counters->start();
+            }
+            const alloc::Scope allocations;
+            const auto start = Clock::now();
+            std::size_t bytes = 0;
+            std::array<Answer, 2> answers;
+            try {
+                AOC2025_TRACE_ZONE("runner/stream", day_number);
+                ChunkReader reader(options.stream_path, options.stream_chunk_size);
+                while (auto chunk = reader.next()) {
+                    bytes += chunk->size();
+                    for_each_solver([&](std::size_t, StreamSolver& solver) { solver.feed(*chunk); });
+                }
+                for_each_solver([&](std::size_t i, StreamSolver& solver) { answers[i] = solver.finish(); });
+            } catch (const std::exception& error) {
+                err << error.what() << '\n';
+                return 1;
+            }
+            AOC2025_TRACE_COUNTER("input_bytes", bytes);
+            const double stream_ms = elapsed_ms(start);
+
+            out << "Day " << day_number << ":\n";
+            if (options.show_timings) {
+                out << "  Stream: " << std::fixed << std::setprecision(3) << stream_ms << " ms, " << bytes
+                    << " bytes\n";
+            }
+            if (counters) {
+                out << "    ";
+                print_perf_sample(out, counters->stop());
+                out << '\n';
+            }
+            if (options.alloc_stats) {
+                out << "    ";
+                alloc::print_stats(out, allocations.stop());
+                out << '\n';
+            }
+            bool failed = false;
+            for (int part = 1; part <= 2; ++part) {
+                if (!solvers[part - 1]) {
+                    out << "  Part " << part << ": Not yet unlocked\n";
+                    continue;
+                }
+                if (!errors[part - 1]) {
+                    out << "  Part " << part << ": " << answers[part - 1] << '\n';
+                    continue;
+                }
+                out << "  Part " << part << ": failed\n";
+                failed = true;
+                try {
+                    std::rethrow_exception(errors[part - 1]);
+                } catch (const std::exception& error) {
+                    err << "Day " << day_number << " part " << part << ": " << error.what() << '\n';
+                }
+            }
+            out << '\n';
+            return failed ? 2 : 0;
+        }
+    }
+
+    int run(const RunOptions& requested, std::ostream& out, std::ostream& err) {
+        RunOptions options = requested;
+        if (options.perf_counters) {
+            options.show_timings = true;
+            if (!PerfCounters().available()) {
+                err << "Performance counters unavailable (check perf_event_paranoid), reporting time only\n";
+                options.perf_counters = false;
+            }
+        }
+        if (options.alloc_stats) {
+            options.show_timings = true;
+            if (!alloc::tracking_compiled()) {
+                err << "Allocation counting is not compiled in, reconfigure with -DAOC2025_ALLOC_STATS=ON\n";
+                options.alloc_stats = false;
+            }
+        }
+
+        if (!options.stream_path.empty()) {
+            const int status = run_stream(options, out, err);
+            if (status != 1 && requested.alloc_stats) {
+                out << "Peak RSS: ";
+                alloc::print_bytes(out, alloc::peak_rss_bytes());
+                out << '\n';
+            }
+            return status;
+        }
+
+        std::vector<int> days_to_run = options.days;
+        if (days_to_run.empty()) {
+            for (const auto& [day_num, _] : days) {
+                days_to_run.push_back(day_num);
+            }
+        }
+
+        const AnswerCache cache(options.cache_directory);
+
+        std::vector<std::unique_ptr<DayJob>> jobs;
+        jobs.reserve(days_to_run.size());
+        for (int day_number : days_to_run) {
+            auto job = std::make_unique<DayJob>();
+            job->day_number = day_number;
+            const auto it = days.find(day_number);
+            if (it != days.end()) {
+                job->day = &it->second;
+            }
+            jobs.push_back(std::move(job));
+        }
+
+        // Futures are taken before any task can touch the promises
+        std::vector<std::future<void>> loads;
+        std::vector<std::array<std::future<PartResult>, 2>> results;
+        for (auto& job : jobs) {
+            loads.push_back(job->loaded.get_future());
+            results.push_back({job->parts[0].get_future(), job->parts[1].get_future()});
+        }
+
+        // Declared after the jobs so it drains before they are destroyed
+        ThreadPool pool(options.threads);
+        for (auto& job : jobs) {
+            if (job->day != nullptr) {
+                pool.submit([&pool, &options, &cache, &job = *job]() { load_and_solve(pool, options, cache, job); });
+            }
+        }
+
+        bool failed = false;
+        for (std::size_t i = 0; i < jobs.size(); ++i) {
+            const DayJob& job = *jobs[i];
+            if (job.day == nullptr) {
+                err << "Day " << job.day_number << " not implemented yet\n";
+                continue;
+            }
+
+            out << "Day " << job.day_number << ":\n";
+            try {
+                loads[i].get();
+            } catch (const std::exception& error) {
+                // Without its input no part of the day could be solved
+                for (int part = 1; part <= 2; ++part) {
+                    if (job.day->has_part(part)) {
+                        out << "  Part " << part << ": failed\n";
+                        err << "Day " << job.day_number << " part " << part << ": " << error.what() << '\n';
+                        failed = true;
+                    } else {
+                        out << "  Part " << part << ": Not yet unlocked\n";
+                    }
+                }
+                out << '\n';
+                continue;
+            }
+
+            if (options.show_timings) {
+                out << "  Load: " << std::fixed << std::setprecision(3) << job.load_ms << " ms"
+                    << ", Parse: " << job.parse_ms << " ms" << (job.model_from_sidecar ? " (sidecar)" : "");
+                if (job.store_ms) {
+                    out << ", Sidecar store: " << *job.store_ms << " ms";
+                }
+                out << '\n';
+                if (job.parse_perf) {
+                    out << "    ";
+                    print_perf_sample(out, *job.parse_perf);
+                    out << '\n';
+                }
+                if (job.parse_allocations) {
+                    out << "    ";
+                    alloc::print_stats(out, *job.parse_allocations);
+                    out << '\n';
+                }
+            }
+            failed |= !print_part(out, err, options, job.day_number, 1, results[i][0]);
+
+            if (job.day->part2.has_value()) {
+                failed |= !print_part(out, err, options, job.day_number, 2, results[i][1]);
+            } else {
+                out << "  Part 2: Not yet unlocked\n";
+            }
+            out << '\n';
+        }
+
+        if (requested.alloc_stats) {
+            out << "Peak RSS: ";
+            alloc::print_bytes(out, alloc::peak_rss_bytes());
+            out << '\n';
+        }
+
+        return failed ? 2 : 0;
+    }
+}
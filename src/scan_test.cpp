@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "scan.hpp"
+
+namespace scan_tests {
+
+static std::vector<std::string_view> collect(aoc2025::scan::Fields fields) {
+    return {fields.begin(), fields.end()};
+}
+
+TEST_CASE("Scan: lines - Trailing And Empty Lines", "[scan][component]") {
+    // Assert
+    REQUIRE(collect(aoc2025::scan::lines("a\nbb\n")) == std::vector<std::string_view>{"a", "bb"});
+    REQUIRE(collect(aoc2025::scan::lines("a\n\nb")) == std::vector<std::string_view>{"a", "", "b"});
+    REQUIRE(collect(aoc2025::scan::lines("\n")) == std::vector<std::string_view>{""});
+    REQUIRE(collect(aoc2025::scan::lines("")).empty());
+}
+
+TEST_CASE("Scan: split - Fields Point Into Input", "[scan][component]") {
+    // Arrange
+    const std::string_view input = "11-22,95-115,,998-1012";
+    
+    // Act
+    const auto fields = collect(aoc2025::scan::split(input, ','));
+    
+    // Assert
+    REQUIRE(fields == std::vector<std::string_view>{"11-22", "95-115", "", "998-1012"});
+    REQUIRE(fields[1].data() == input.data() + 6);
+}
+
+TEST_CASE("Scan: find_byte And count_byte", "[scan][component]") {
+    // Arrange
+    const std::string input = std::string(100, 'x') + ",y,";
+    
+    // Assert
+    REQUIRE(aoc2025::scan::find_byte(input, ',') == 100);
+    REQUIRE(aoc2025::scan::find_byte(input, ',', 101) == 102);
+    REQUIRE(aoc2025::scan::find_byte(input, ',', 103) == std::string_view::npos);
+    REQUIRE(aoc2025::scan::count_byte(input, ',') == 2);
+}
+
+TEST_CASE("Scan: trim - Whitespace Including CR", "[scan][component]") {
+    // Assert
+    REQUIRE(aoc2025::scan::trim(" \t123\r\n") == "123");
+    REQUIRE(aoc2025::scan::trim("\r\n").empty());
+}
+
+TEST_CASE("Scan: try_parse_int - Digit Counts Around The SWAR Block", "[scan][component]") {
+    // Arrange
+    std::uint64_t expected = 0;
+    std::string digits;
+    
+    // Act & Assert
+    for (int length = 1; length <= 19; ++length) {
+        digits += static_cast<char>('0' + (length * 7) % 10);
+        expected = expected * 10 + static_cast<std::uint64_t>((length * 7) % 10);
+        REQUIRE(aoc2025::scan::try_parse_int<std::uint64_t>(digits) == expected);
+    }
+}
+
+TEST_CASE("Scan: try_parse_int - Limits And Signs", "[scan][component]") {
+    // Assert
+    REQUIRE(aoc2025::scan::try_parse_int<std::int64_t>("-9223372036854775808") == std::numeric_limits<std::int64_t>::min());
+    REQUIRE(aoc2025::scan::try_parse_int<std::int64_t>("9223372036854775807") == std::numeric_limits<std::int64_t>::max());
+    REQUIRE_FALSE(aoc2025::scan::try_parse_int<std::int64_t>("9223372036854775808").has_value());
+    REQUIRE(aoc2025::scan::try_parse_int<std::uint64_t>("18446744073709551615") == std::numeric_limits<std::uint64_t>::max());
+    REQUIRE_FALSE(aoc2025::scan::try_parse_int<std::uint64_t>("18446744073709551616").has_value());
+    REQUIRE(aoc2025::scan::try_parse_int<int>("-42") == -42);
+    REQUIRE_FALSE(aoc2025::scan::try_parse_int<unsigned>("-42").has_value());
+    REQUIRE_FALSE(aoc2025::scan::try_parse_int<std::uint8_t>("256").has_value());
+}
+
+TEST_CASE("Scan: try_parse_int - Rejects Non-Digits", "[scan][component]") {
+    // Assert
+    REQUIRE_FALSE(aoc2025::scan::try_parse_int<int>("").has_value());
+    REQUIRE_FALSE(aoc2025::scan::try_parse_int<int>("-").has_value());
+    REQUIRE_FALSE(aoc2025::scan::try_parse_int<int>("12a").has_value());
+    REQUIRE_FALSE(aoc2025::scan::try_parse_int<std::int64_t>("1234567a").has_value());
+    REQUIRE_FALSE(aoc2025::scan::try_parse_int<std::int64_t>("123456789/").has_value());
+    REQUIRE_FALSE(aoc2025::scan::try_parse_int<int>(" 12").has_value());
+}
+
+TEST_CASE("Scan: parse_int - Error Names The Field", "[scan][component]") {
+    // Act & Assert
+    REQUIRE(aoc2025::scan::parse_int<int>("68") == 68);
+    try {
+        aoc2025::scan::parse_int<int>("6x", "steps");
+        FAIL("expected std::invalid_argument");
+    } catch (const std::invalid_argument& error) {
+        REQUIRE(std::string(error.what()) == "Invalid steps: '6x'");
+    }
+}
+
+} // namespace scan_tests
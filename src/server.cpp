@@ -0,0 +1,514 @@
+#include "server.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#include "aoc2025.hpp"
+#include "compression.hpp"
+#include "trace.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define AOC2025_HAVE_UNIX_SOCKETS 1
+#endif
+
+namespace aoc2025 {
+    void LatencyStats::record(std::uint64_t ns, bool ok) {
+        std::lock_guard lock(mutex_);
+        if (window_.size() < kWindow) {
+            window_.push_back(ns);
+        } else {
+            window_[next_] = ns;
+            next_ = (next_ + 1) % kWindow;
+        }
+        ++count_;
+        if (!ok) {
+            ++errors_;
+        }
+        max_ns_ = std::max(max_ns_, ns);
+    }
+
+    LatencyStats::Summary LatencyStats::summary() const {
+        std::vector<std::uint64_t> sorted;
+        Summary summary;
+        {
+            std::lock_guard lock(mutex_);
+            sorted = window_;
+            summary.count = count_;
+            summary.errors = errors_;
+            summary.max_ns = max_ns_;
+        }
+        if (sorted.empty()) {
+            return summary;
+        }
+        std::sort(sorted.begin(), sorted.end());
+        auto percentile = [&](std::size_t p) { return sorted[(sorted.size() - 1) * p / 100]; };
+        summary.p50_ns = percentile(50);
+        summary.p99_ns = percentile(99);
+        return summary;
+    }
+
+    std::string LatencyStats::format(const Summary& summary) {
+        std::ostringstream out;
+        out << "requests=" << summary.count << " errors=" << summary.errors << std::fixed << std::setprecision(1)
+            << " p50_us=" << static_cast<double>(summary.p50_ns) / 1e3
+            << " p99_us=" << static_cast<double>(summary.p99_ns) / 1e3
+            << " max_us=" << static_cast<double>(summary.max_ns) / 1e3;
+        return out.str();
+    }
+
+    bool SliceAccess::allows(const std::filesystem::path& path) const {
+        if (any_file) {
+            return true;
+        }
+        std::error_code error;
+        const std::filesystem::path file = std::filesystem::canonical(path, error);
+        if (error) {
+            return false;
+        }
+        return std::any_of(roots.begin(), roots.end(), [&](const std::filesystem::path& root) {
+            std::error_code root_error;
+            const std::filesystem::path directory = std::filesystem::canonical(root, root_error);
+            if (root_error) {
+                return false;
+            }
+            const auto [mismatch, unused] = std::mismatch(directory.begin(), directory.end(), file.begin(), file.end());
+            return mismatch == directory.end();
+        });
+    }
+
+    protocol::Response solve_request(const protocol::Request& request, const SliceAccess& access) {
+        protocol::Response response{request.id, protocol::Status::kOk, {}};
+        try {
+            const auto it = days.find(request.day);
+            if (it == days.end()) {
+                throw std::invalid_argument("Day " + std::to_string(request.day) + " not implemented yet");
+            }
+            if (!it->second.has_part(request.part)) {
+                throw std::invalid_argument("Day " + std::to_string(request.day) + " has no part " +
+                                            std::to_string(request.part));
+            }
+            if (request.kind == protocol::Kind::kSolveSlice) {
+                const protocol::Slice slice = protocol::decode_slice(request.input);
+                if (!access.allows(slice.path)) {
+                    throw std::invalid_argument("Slices of " + slice.path + " are not served here");
+                }
+                // Byte ranges are of the file as stored; a compressed file would
+                // have to be inflated in full for every shard
+                const Input input = Input::open_raw(slice.path);
+                if (compression::detect(input.view()) != compression::Format::kNone) {
+                    throw std::invalid_argument("Slices of compressed " + slice.path + " are not served");
+                }
+                if (slice.offset > input.size() || slice.size > input.size() - slice.offset) {
+                    throw std::invalid_argument("Slice beyond the end of " + slice.path);
+                }
+                const std::string_view bytes = input.view().substr(slice.offset, slice.size);
+                response.text = it->second.solve(request.part, bytes).to_string();
+            } else {
+                response.text = it->second.solve(request.part, request.input).to_string();
+            }
+        } catch (const std::exception& error) {
+            response.status = protocol::Status::kError;
+            response.text = error.what();
+        }
+        return response;
+    }
+
+#ifdef AOC2025_HAVE_UNIX_SOCKETS
+    namespace {
+        std::runtime_error socket_error(const std::string& what) {
+            return std::runtime_error(what + ": " + std::strerror(errno));
+        }
+
+        sockaddr_un socket_address(const std::string& path) {
+            sockaddr_un address {};
+            address.sun_family = AF_UNIX;
+            if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+                throw std::runtime_error("Invalid socket path: " + path);
+            }
+            std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+            return address;
+        }
+
+        // Clears the way for bind: nothing at path is fine, a socket no one
+        // answers on is a leftover from a daemon that died and is removed.
+        // Anything else, a live daemon's socket or a file that is not a
+        // socket at all, is left alone and refused.
+        void claim_socket_path(const sockaddr_un& address, const std::string& path) {
+            struct stat status {};
+            if (::lstat(path.c_str(), &status) != 0) {
+                if (errno == ENOENT) {
+                    return;
+                }
+                throw socket_error("Error checking " + path);
+            }
+            if (!S_ISSOCK(status.st_mode)) {
+                throw std::runtime_error("Refusing to serve on " + path + ": it exists and is not a socket");
+            }
+            const int probe = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (probe < 0) {
+                throw socket_error("Error creating socket");
+            }
+            const bool live = ::connect(probe, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0;
+            ::close(probe);
+            if (live) {
+                throw std::runtime_error("Refusing to serve on " + path + ": another daemon is listening on it");
+            }
+            ::unlink(path.c_str());
+        }
+
+        std::uint64_t now_ns() {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+        }
+    }
+
+    bool write_all(int fd, std::string_view bytes) {
+        while (!bytes.empty()) {
+#ifdef MSG_NOSIGNAL
+            const ssize_t count = ::send(fd, bytes.data(), bytes.size(), MSG_NOSIGNAL);
+#else
+            const ssize_t count = ::send(fd, bytes.data(), bytes.size(), 0);
+#endif
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            if (count <= 0) {
+                return false;
+            }
+            bytes.remove_prefix(static_cast<std::size_t>(count));
+        }
+        return true;
+    }
+
+    int connect_socket(const std::string& path) {
+        const sockaddr_un address = socket_address(path);
+        const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) {
+            throw socket_error("Error creating socket");
+        }
+        if (::connect(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0) {
+            const std::runtime_error error = socket_error("Error connecting to " + path);
+            ::close(fd);
+            throw error;
+        }
+        ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+        return fd;
+    }
+
+    struct Server::Connection {
+        int fd;
+        std::mutex write_mutex;
+        std::thread reader;
+        std::atomic<bool> done{false};
+
+        explicit Connection(int socket) : fd(socket) {}
+
+        ~Connection() {
+            ::close(fd);
+        }
+
+        void send(const protocol::Response& response) {
+            const std::string frame = protocol::encode(response);
+            std::lock_guard lock(write_mutex);
+            write_all(fd, frame);
+        }
+    };
+
+    Server::Server(ServeOptions options)
+        : options_(std::move(options)), slice_access_{false, options_.slice_roots} {
+        const sockaddr_un address = socket_address(options_.socket_path);
+        if (::pipe(wake_fds_) != 0) {
+            throw socket_error("Error creating wake pipe");
+        }
+        listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_fd_ < 0) {
+            throw socket_error("Error creating socket");
+        }
+        ::fcntl(listen_fd_, F_SETFD, FD_CLOEXEC);
+        try {
+            claim_socket_path(address, options_.socket_path);
+            if (::bind(listen_fd_, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 ||
+                ::listen(listen_fd_, SOMAXCONN) != 0) {
+                throw socket_error("Error listening on " + options_.socket_path);
+            }
+        } catch (...) {
+            ::close(listen_fd_);
+            ::close(wake_fds_[0]);
+            ::close(wake_fds_[1]);
+            throw;
+        }
+        struct stat status {};
+        if (::lstat(options_.socket_path.c_str(), &status) == 0) {
+            socket_inode_ = static_cast<std::uint64_t>(status.st_ino);
+        }
+        pool_ = std::make_unique<ThreadPool>(options_.threads);
+    }
+
+    Server::~Server() {
+        reap_connections(true);
+        pool_.reset();
+        ::close(listen_fd_);
+        ::close(wake_fds_[0]);
+        ::close(wake_fds_[1]);
+        // Only the socket this server bound: if the path was replaced since,
+        // it belongs to someone else now
+        struct stat status {};
+        if (::lstat(options_.socket_path.c_str(), &status) == 0 && S_ISSOCK(status.st_mode) &&
+            static_cast<std::uint64_t>(status.st_ino) == socket_inode_) {
+            ::unlink(options_.socket_path.c_str());
+        }
+    }
+
+    void Server::stop() {
+        const char byte = 0;
+        [[maybe_unused]] const ssize_t written = ::write(wake_fds_[1], &byte, 1);
+    }
+
+    void Server::run() {
+        AOC2025_TRACE_THREAD("server");
+        for (;;) {
+            pollfd fds[2] = {{listen_fd_, POLLIN, 0}, {wake_fds_[0], POLLIN, 0}};
+            if (::poll(fds, 2, -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw socket_error("Error polling socket");
+            }
+            if (fds[1].revents != 0) {
+                break;
+            }
+            if ((fds[0].revents & POLLIN) == 0) {
+                continue;
+            }
+            const int fd = ::accept(listen_fd_, nullptr, nullptr);
+            if (fd < 0) {
+                continue;
+            }
+            ::fcntl(fd, F_SETFD, FD_CLOEXEC);
+            reap_connections(false);
+            auto connection = std::make_shared<Connection>(fd);
+            std::lock_guard lock(connections_mutex_);
+            if (connections_.size() >= options_.max_connections) {
+                connection->send({0, protocol::Status::kError, "Too many connections"});
+                continue;
+            }
+            connections_.push_back(connection);
+            connection->reader = std::thread([this, connection]() { serve_connection(connection); });
+        }
+        reap_connections(true);
+    }
+
+    // Join readers that have finished, or with all set, wake and join every reader
+    void Server::reap_connections(bool all) {
+        std::list<std::shared_ptr<Connection>> finished;
+        {
+            std::lock_guard lock(connections_mutex_);
+            for (auto it = connections_.begin(); it != connections_.end();) {
+                if (all || (*it)->done) {
+                    if (all) {
+                        ::shutdown((*it)->fd, SHUT_RD);
+                    }
+                    finished.push_back(*it);
+                    it = connections_.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+        }
+        for (auto& connection : finished) {
+            connection->reader.join();
+        }
+    }
+
+    void Server::serve_connection(const std::shared_ptr<Connection>& connection) {
+        AOC2025_TRACE_THREAD("connection");
+        protocol::FrameDecoder decoder;
+        std::string buffer(std::size_t{1} << 16, '\0');
+        try {
+            for (;;) {
+                const ssize_t count = ::read(connection->fd, buffer.data(), buffer.size());
+                if (count < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (count <= 0) {
+                    break;
+                }
+                const std::uint64_t received_ns = now_ns();
+                decoder.feed(std::string_view(buffer.data(), static_cast<std::size_t>(count)));
+                while (auto payload = decoder.next()) {
+                    handle(connection, protocol::decode_request(*payload), received_ns);
+                }
+            }
+        } catch (const std::exception& error) {
+            // A malformed stream cannot be resynchronised, so report it and hang
+            // up; the client reads the error and then EOF
+            connection->send({0, protocol::Status::kError, error.what()});
+            ::shutdown(connection->fd, SHUT_RDWR);
+        }
+        connection->done = true;
+    }
+
+    void Server::handle(const std::shared_ptr<Connection>& connection, protocol::Request request,
+                        std::uint64_t received_ns) {
+        if (request.kind == protocol::Kind::kStats) {
+            connection->send({request.id, protocol::Status::kOk, LatencyStats::format(stats_.summary())});
+            return;
+        }
+        pool_->submit([this, connection, request = std::move(request), received_ns]() {
+            AOC2025_TRACE_ZONE("server/solve", request.day);
+            const protocol::Response response = solve_request(request, slice_access_);
+            // Recorded before replying so a client that has its answer also sees it counted
+            stats_.record(now_ns() - received_ns, response.status == protocol::Status::kOk);
+            connection->send(response);
+        });
+    }
+
+    Client::Client(const std::string& socket_path) : fd_(connect_socket(socket_path)) {}
+
+    Client::~Client() {
+        ::close(fd_);
+    }
+
+    void Client::send(const protocol::Request& request) {
+        if (!write_all(fd_, protocol::encode(request))) {
+            throw socket_error("Error sending request");
+        }
+    }
+
+    protocol::Response Client::receive() {
+        std::string buffer(std::size_t{1} << 16, '\0');
+        for (;;) {
+            if (auto payload = decoder_.next()) {
+                return protocol::decode_response(*payload);
+            }
+            const ssize_t count = ::read(fd_, buffer.data(), buffer.size());
+            if (count < 0 && errno == EINTR) {
+                continue;
+            }
+            if (count <= 0) {
+                throw std::runtime_error("Server closed the connection");
+            }
+            decoder_.feed(std::string_view(buffer.data(), static_cast<std::size_t>(count)));
+        }
+    }
+
+    Answer Client::solve(int day, int part, std::string_view input) {
+        send({0, protocol::Kind::kSolve, static_cast<std::uint8_t>(day), static_cast<std::uint8_t>(part),
+              std::string(input)});
+        const protocol::Response response = receive();
+        if (response.status != protocol::Status::kOk) {
+            throw std::runtime_error(response.text);
+        }
+        return Answer::parse(response.text);
+    }
+
+    std::string Client::stats() {
+        send({0, protocol::Kind::kStats, 0, 0, {}});
+        return receive().text;
+    }
+
+    void serve_socket(int fd) {
+        AOC2025_TRACE_THREAD("worker");
+        protocol::FrameDecoder decoder;
+        std::string buffer(std::size_t{1} << 16, '\0');
+        try {
+            for (;;) {
+                while (auto payload = decoder.next()) {
+                    const protocol::Request request = protocol::decode_request(*payload);
+                    const protocol::Response response = request.kind == protocol::Kind::kStats
+                        ? protocol::Response{request.id, protocol::Status::kError, "No stats from a socket worker"}
+                        : solve_request(request, SliceAccess{true, {}});
+                    if (!write_all(fd, protocol::encode(response))) {
+                        return;
+                    }
+                }
+                const ssize_t count = ::read(fd, buffer.data(), buffer.size());
+                if (count < 0 && errno == EINTR) {
+                    continue;
+                }
+                if (count <= 0) {
+                    return;
+                }
+                decoder.feed(std::string_view(buffer.data(), static_cast<std::size_t>(count)));
+            }
+        } catch (const std::exception& error) {
+            write_all(fd, protocol::encode(protocol::Response{0, protocol::Status::kError, error.what()}));
+        }
+    }
+
+    namespace {
+        Server* signalled_server = nullptr;
+
+        void stop_on_signal(int) {
+            if (signalled_server != nullptr) {
+                signalled_server->stop();
+            }
+        }
+    }
+
+    int serve(const ServeOptions& options, std::ostream& err) {
+        try {
+            Server server(options);
+            signalled_server = &server;
+            std::signal(SIGPIPE, SIG_IGN);
+            std::signal(SIGINT, stop_on_signal);
+            std::signal(SIGTERM, stop_on_signal);
+            err << "Serving on " << options.socket_path << '\n';
+            server.run();
+            std::signal(SIGINT, SIG_DFL);
+            std::signal(SIGTERM, SIG_DFL);
+            signalled_server = nullptr;
+            err << LatencyStats::format(server.stats().summary()) << '\n';
+            return 0;
+        } catch (const std::exception& error) {
+            signalled_server = nullptr;
+            err << error.what() << '\n';
+            return 1;
+        }
+    }
+#else
+    struct Server::Connection {};
+
+    Server::Server(ServeOptions options) : options_(std::move(options)) {
+        throw std::runtime_error("Unix domain sockets are not supported on this platform");
+    }
+
+    Server::~Server() = default;
+    void Server::stop() {}
+    void Server::run() {}
+
+    Client::Client(const std::string&) {
+        throw std::runtime_error("Unix domain sockets are not supported on this platform");
+    }
+
+    bool write_all(int, std::string_view) { return false; }
+
+    int connect_socket(const std::string&) {
+        throw std::runtime_error("Unix domain sockets are not supported on this platform");
+    }
+
+    Client::~Client() = default;
+    void Client::send(const protocol::Request&) {}
+    protocol::Response Client::receive() { return {}; }
+    Answer Client::solve(int, int, std::string_view) { return {}; }
+    std::string Client::stats() { return {}; }
+    void serve_socket(int) {}
+
+    int serve(const ServeOptions&, std::ostream& err) {
+        err << "--serve needs Unix domain sockets, which this platform lacks\n";
+        return 1;
+    }
+#endif
+}
@@ -0,0 +1,290 @@
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <thread>
+#include "aoc2025.hpp"
+#include "day1.hpp"
+#include "day2.hpp"
+#include "day3.hpp"
+#include "protocol.hpp"
+#include "server.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace server_tests {
+
+TEST_CASE("Server: Protocol - Request Round Trip", "[server][component]") {
+    // Arrange
+    const aoc2025::protocol::Request request{0x01020304, aoc2025::protocol::Kind::kSolve, 3, 2, "987\n123"};
+    
+    // Act
+    const std::string frame = aoc2025::protocol::encode(request);
+    aoc2025::protocol::FrameDecoder decoder;
+    decoder.feed(frame);
+    const auto payload = decoder.next();
+    
+    // Assert
+    REQUIRE(frame.size() == 4 + 7 + 7);
+    REQUIRE(payload.has_value());
+    const auto decoded = aoc2025::protocol::decode_request(*payload);
+    REQUIRE(decoded.id == 0x01020304);
+    REQUIRE(decoded.kind == aoc2025::protocol::Kind::kSolve);
+    REQUIRE(decoded.day == 3);
+    REQUIRE(decoded.part == 2);
+    REQUIRE(decoded.input == "987\n123");
+}
+
+TEST_CASE("Server: Protocol - Slice Round Trip", "[server][component]") {
+    // Arrange
+    const aoc2025::protocol::Slice slice{std::uint64_t{1} << 40, 4096, "/data/day3.txt"};
+    
+    // Act
+    const auto decoded = aoc2025::protocol::decode_slice(aoc2025::protocol::encode(slice));
+    
+    // Assert
+    REQUIRE(decoded.offset == slice.offset);
+    REQUIRE(decoded.size == slice.size);
+    REQUIRE(decoded.path == slice.path);
+    REQUIRE_THROWS_AS(aoc2025::protocol::decode_slice("short"), std::invalid_argument);
+}
+
+TEST_CASE("Server: solve_request - Slices Only Of Allowed Plain Files", "[server][component]") {
+    // Arrange
+    aoc2025::register_day(Day3::Day3);
+    const auto root = std::filesystem::temp_directory_path() / "aoc2025_server_slices";
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "shared");
+    const std::string input = "987654321111111\n123456789\n999888777";
+    for (const auto& [name, contents] : {std::pair{"shared/day3.txt", input}, std::pair{"private.txt", input},
+                                         std::pair{"shared/day3.txt.gz", std::string("\x1f\x8b\x08\0", 4)}}) {
+        std::ofstream file(root / name, std::ios::binary);
+        file << contents;
+    }
+    const aoc2025::SliceAccess access{false, {root / "shared"}};
+    auto slice = [](const std::filesystem::path& path) {
+        return aoc2025::protocol::Request{7, aoc2025::protocol::Kind::kSolveSlice, 3, 1,
+                                          aoc2025::protocol::encode(aoc2025::protocol::Slice{0, 16, path.string()})};
+    };
+
+    // Act
+    const auto allowed = aoc2025::solve_request(slice(root / "shared/day3.txt"), access);
+    const auto outside = aoc2025::solve_request(slice(root / "private.txt"), access);
+    const auto escaped = aoc2025::solve_request(slice(root / "shared/../private.txt"), access);
+    const auto compressed = aoc2025::solve_request(slice(root / "shared/day3.txt.gz"), access);
+    const auto refused = aoc2025::solve_request(slice(root / "shared/day3.txt"), aoc2025::SliceAccess{});
+
+    // Assert
+    REQUIRE(allowed.status == aoc2025::protocol::Status::kOk);
+    REQUIRE(allowed.text == "98");
+    REQUIRE(outside.status == aoc2025::protocol::Status::kError);
+    REQUIRE(escaped.status == aoc2025::protocol::Status::kError);
+    REQUIRE(compressed.status == aoc2025::protocol::Status::kError);
+    REQUIRE(refused.status == aoc2025::protocol::Status::kError);
+    std::filesystem::remove_all(root);
+}
+
+TEST_CASE("Server: FrameDecoder - Split And Merged Frames", "[server][component]") {
+    // Arrange
+    const std::string stream = aoc2025::protocol::encode(aoc2025::protocol::Response{1, aoc2025::protocol::Status::kOk, "42"}) +
+                               aoc2025::protocol::encode(aoc2025::protocol::Response{2, aoc2025::protocol::Status::kError, "bad"});
+    aoc2025::protocol::FrameDecoder decoder;
+    std::vector<aoc2025::protocol::Response> responses;
+    
+    // Act
+    for (const char byte : stream) {
+        decoder.feed(std::string_view(&byte, 1));
+        while (auto payload = decoder.next()) {
+            responses.push_back(aoc2025::protocol::decode_response(*payload));
+        }
+    }
+    
+    // Assert
+    REQUIRE(responses.size() == 2);
+    REQUIRE(responses[0].id == 1);
+    REQUIRE(responses[0].text == "42");
+    REQUIRE(responses[1].status == aoc2025::protocol::Status::kError);
+    REQUIRE(responses[1].text == "bad");
+    REQUIRE(decoder.buffered() == 0);
+}
+
+TEST_CASE("Server: Protocol - Malformed Payloads", "[server][component]") {
+    // Assert
+    REQUIRE_THROWS_AS(aoc2025::protocol::decode_request("abc"), std::invalid_argument);
+    REQUIRE_THROWS_AS(aoc2025::protocol::decode_request(std::string("\0\0\0\0\x09\x01\x01", 7)), std::invalid_argument);
+
+    aoc2025::protocol::FrameDecoder decoder;
+    decoder.feed(std::string("\xff\xff\xff\xff", 4));
+    REQUIRE_THROWS_AS(decoder.next(), std::length_error);
+
+    // A 1 GiB frame is refused from its header alone
+    aoc2025::protocol::FrameDecoder large;
+    large.feed(std::string("\0\0\0\x40", 4));
+    REQUIRE_THROWS_AS(large.next(), std::length_error);
+}
+
+TEST_CASE("Server: LatencyStats - Percentiles", "[server][component]") {
+    // Arrange
+    aoc2025::LatencyStats stats;
+    
+    // Act
+    for (std::uint64_t ns = 1; ns <= 100; ++ns) {
+        stats.record(ns * 1000, ns != 100);
+    }
+    const auto summary = stats.summary();
+    
+    // Assert
+    REQUIRE(summary.count == 100);
+    REQUIRE(summary.errors == 1);
+    REQUIRE(summary.p50_ns == 50000);
+    REQUIRE(summary.p99_ns == 99000);
+    REQUIRE(summary.max_ns == 100000);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_CASE("Server: Serve - Pipelined Requests", "[server][integration]") {
+    // Arrange
+    aoc2025::register_day(Day1::Day1);
+    aoc2025::register_day(Day2::Day2);
+    aoc2025::register_day(Day3::Day3);
+    const auto socket_path = std::filesystem::temp_directory_path() / "aoc2025_server_test.sock";
+    aoc2025::Server server({socket_path.string(), 2});
+    std::thread accept_loop([&server]() { server.run(); });
+    
+    // Act
+    std::set<std::pair<std::uint32_t, std::string>> answers;
+    std::string stats;
+    {
+        aoc2025::Client client(socket_path.string());
+        client.send({1, aoc2025::protocol::Kind::kSolve, 1, 1, "L68\nL30\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82"});
+        client.send({2, aoc2025::protocol::Kind::kSolve, 1, 2, "L68\nL30\nR48\nL5\nR60\nL55\nL1\nL99\nR14\nL82"});
+        client.send({3, aoc2025::protocol::Kind::kSolve, 3, 1, "987654321111111\n123456789\n999888777"});
+        client.send({4, aoc2025::protocol::Kind::kSolve, 9, 1, ""});
+        for (int i = 0; i < 4; ++i) {
+            const auto response = client.receive();
+            answers.emplace(response.id, response.status == aoc2025::protocol::Status::kOk ? response.text : "error");
+        }
+        stats = client.stats();
+        REQUIRE(client.solve(2, 1, "11-22") == aoc2025::Answer(33));
+        REQUIRE_THROWS_AS(client.solve(3, 3, "1"), std::runtime_error);
+    }
+    server.stop();
+    accept_loop.join();
+    
+    // Assert
+    const std::set<std::pair<std::uint32_t, std::string>> expected{{1, "3"}, {2, "6"}, {3, "286"}, {4, "error"}};
+    REQUIRE(answers == expected);
+    REQUIRE(stats.rfind("requests=4 errors=1 ", 0) == 0);
+    REQUIRE(server.stats().summary().count == 6);
+}
+
+TEST_CASE("Server: Serve - Malformed Frame Hangs Up", "[server][integration]") {
+    // Arrange
+    const auto socket_path = std::filesystem::temp_directory_path() / "aoc2025_server_malformed.sock";
+    aoc2025::Server server({socket_path.string(), 1});
+    std::thread accept_loop([&server]() { server.run(); });
+    const int fd = aoc2025::connect_socket(socket_path.string());
+    // Fails the test instead of hanging it if the server never hangs up
+    const timeval timeout{5, 0};
+    ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    // Act
+    REQUIRE(aoc2025::write_all(fd, std::string("\xff\xff\xff\xff", 4)));
+    aoc2025::protocol::FrameDecoder decoder;
+    std::string buffer(4096, '\0');
+    ssize_t count = 0;
+    while ((count = ::read(fd, buffer.data(), buffer.size())) > 0) {
+        decoder.feed(std::string_view(buffer.data(), static_cast<std::size_t>(count)));
+    }
+    ::close(fd);
+    server.stop();
+    accept_loop.join();
+
+    // Assert
+    REQUIRE(count == 0);
+    const auto payload = decoder.next();
+    REQUIRE(payload.has_value());
+    REQUIRE(aoc2025::protocol::decode_response(*payload).status == aoc2025::protocol::Status::kError);
+    REQUIRE_FALSE(decoder.next().has_value());
+}
+
+TEST_CASE("Server: Serve - Refuses Connections Over The Limit", "[server][integration]") {
+    // Arrange
+    aoc2025::register_day(Day2::Day2);
+    const auto socket_path = std::filesystem::temp_directory_path() / "aoc2025_server_limit.sock";
+    aoc2025::ServeOptions options{socket_path.string(), 1};
+    options.max_connections = 1;
+    aoc2025::Server server(options);
+    std::thread accept_loop([&server]() { server.run(); });
+
+    // Act
+    aoc2025::Client first(socket_path.string());
+    const aoc2025::Answer answer = first.solve(2, 1, "11-22");
+    aoc2025::Client second(socket_path.string());
+    const aoc2025::protocol::Response refused = second.receive();
+    const aoc2025::Answer still_served = first.solve(2, 1, "95-115");
+    server.stop();
+    accept_loop.join();
+
+    // Assert
+    REQUIRE(answer == aoc2025::Answer(33));
+    REQUIRE(refused.status == aoc2025::protocol::Status::kError);
+    REQUIRE(refused.text == "Too many connections");
+    REQUIRE_THROWS_AS(second.receive(), std::runtime_error);
+    REQUIRE(still_served == aoc2025::Answer(99));
+}
+
+TEST_CASE("Server: Serve - Leaves Files And Live Daemons Alone", "[server][integration]") {
+    // Arrange
+    const auto directory = std::filesystem::temp_directory_path() / "aoc2025_server_paths";
+    std::filesystem::remove_all(directory);
+    std::filesystem::create_directories(directory);
+    const auto input_path = directory / "data.txt";
+    std::ofstream(input_path) << "L68\n";
+    const auto socket_path = directory / "live.sock";
+    aoc2025::Server live({socket_path.string(), 1});
+    std::ostringstream err;
+
+    // Act
+    const int status = aoc2025::serve({input_path.string(), 1}, err);
+
+    // Assert
+    REQUIRE(status == 1);
+    REQUIRE(err.str().find("not a socket") != std::string::npos);
+    std::ifstream input(input_path);
+    REQUIRE(std::string(std::istreambuf_iterator<char>(input), {}) == "L68\n");
+    REQUIRE_THROWS_AS(aoc2025::Server({socket_path.string(), 1}), std::runtime_error);
+    REQUIRE(std::filesystem::is_socket(socket_path));
+    ::close(aoc2025::connect_socket(socket_path.string()));
+}
+
+TEST_CASE("Server: Serve - Replaces A Stale Socket", "[server][integration]") {
+    // Arrange: a socket file whose daemon exited without removing it
+    const auto socket_path = std::filesystem::temp_directory_path() / "aoc2025_server_stale.sock";
+    std::filesystem::remove(socket_path);
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    std::strcpy(address.sun_path, socket_path.c_str());
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    REQUIRE(::bind(fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0);
+    ::close(fd);
+
+    // Act & Assert
+    REQUIRE(std::filesystem::is_socket(socket_path));
+    REQUIRE_NOTHROW(aoc2025::Server({socket_path.string(), 1}));
+    REQUIRE_FALSE(std::filesystem::exists(socket_path));
+}
+#endif
+
+} // namespace server_tests
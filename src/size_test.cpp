@@ -0,0 +1,34 @@
+#include <catch2/catch_test_macros.hpp>
+#include <limits>
+#include <string>
+#include "size.hpp"
+
+namespace size_tests {
+
+TEST_CASE("Size: parse_size - Suffixes And Overflow", "[size][component]") {
+    // Arrange
+    const std::size_t max = std::numeric_limits<std::size_t>::max();
+
+    // Assert
+    REQUIRE(aoc2025::parse_size("4096") == 4096);
+    REQUIRE(aoc2025::parse_size("64k") == 64 << 10);
+    REQUIRE(aoc2025::parse_size("16M") == 16 << 20);
+    REQUIRE(aoc2025::parse_size("2G") == std::size_t{2} << 30);
+    REQUIRE(aoc2025::parse_size(std::to_string(max >> 30) + "G") == (max >> 30) << 30);
+    REQUIRE(aoc2025::parse_size(std::to_string((max >> 30) + 1) + "G") == 0);
+    REQUIRE(aoc2025::parse_size(std::to_string(max) + "0") == 0);
+    for (const std::string bad : {"", "M", "12Q", "1MB", "-1", " 5", "+5"}) {
+        REQUIRE(aoc2025::parse_size(bad) == 0);
+    }
+}
+
+TEST_CASE("Size: format_size - Round Trips Through parse_size", "[size][component]") {
+    for (const std::size_t bytes : {std::size_t{1000}, std::size_t{4} << 10, std::size_t{3} << 20, std::size_t{2} << 30,
+                                    (std::size_t{1} << 20) + 1}) {
+        // Act & Assert
+        REQUIRE(aoc2025::parse_size(aoc2025::format_size(bytes)) == bytes);
+    }
+    REQUIRE(aoc2025::format_size(std::size_t{64} << 10) == "64K");
+}
+
+} // namespace size_tests
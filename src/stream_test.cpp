@@ -0,0 +1,131 @@
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include "chunk_reader.hpp"
+#include "stream.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace stream_tests {
+
+static std::vector<std::string> split(std::string_view input, char delimiter, std::size_t chunk_size) {
+    aoc2025::RecordSplitter splitter(delimiter);
+    std::vector<std::string> records;
+    auto collect = [&](std::string_view record) { records.emplace_back(record); };
+    for (std::size_t offset = 0; offset < input.size(); offset += chunk_size) {
+        splitter.feed(input.substr(offset, chunk_size), collect);
+    }
+    splitter.finish(collect);
+    return records;
+}
+
+TEST_CASE("Stream: RecordSplitter - Records Across Chunk Boundaries", "[stream][component]") {
+    for (const std::size_t chunk_size : {1, 2, 5, 100}) {
+        // Act
+        const auto records = split("ab,cde,,f", ',', chunk_size);
+        
+        // Assert
+        REQUIRE(records == std::vector<std::string>{"ab", "cde", "", "f"});
+    }
+}
+
+TEST_CASE("Stream: RecordSplitter - Trailing Delimiter", "[stream][component]") {
+    // Act
+    const auto records = split("L1\nR2\n", '\n', 3);
+    
+    // Assert
+    REQUIRE(records == std::vector<std::string>{"L1", "R2"});
+}
+
+TEST_CASE("Stream: ChunkReader - Reassembles File", "[stream][component]") {
+    // Arrange
+    std::string contents;
+    for (int i = 0; i < 1000; ++i) {
+        contents += std::to_string(i) + '\n';
+    }
+    const auto path = std::filesystem::temp_directory_path() / "aoc2025_stream_reader.txt";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << contents;
+    }
+    
+    // Act
+    std::string read;
+    std::size_t chunks = 0;
+    {
+        aoc2025::ChunkReader reader(path.string(), 256, 2);
+        while (auto chunk = reader.next()) {
+            REQUIRE(chunk->size() <= 256);
+            read += *chunk;
+            ++chunks;
+        }
+    }
+    
+    // Assert
+    REQUIRE(read == contents);
+    REQUIRE(chunks == (contents.size() + 255) / 256);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Stream: ChunkReader - Early Exit Does Not Block", "[stream][component]") {
+    // Arrange
+    const auto path = std::filesystem::temp_directory_path() / "aoc2025_stream_early.txt";
+    {
+        std::ofstream file(path, std::ios::binary);
+        file << std::string(64 * 1024, 'x');
+    }
+    
+    // Act
+    std::optional<std::string> first;
+    {
+        aoc2025::ChunkReader reader(path.string(), 16, 1);
+        first = reader.next();
+    }
+    
+    // Assert
+    REQUIRE(first.has_value());
+    REQUIRE(*first == std::string(16, 'x'));
+    std::filesystem::remove(path);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_CASE("Stream: ChunkReader - Early Exit While The Input Is Silent", "[stream][component]") {
+    // Arrange: a pipe whose writer stays open but never writes, like an idle stdin
+    int fds[2];
+    REQUIRE(::pipe(fds) == 0);
+    auto reader = std::make_unique<aoc2025::ChunkReader>("/dev/fd/" + std::to_string(fds[0]), 16, 1);
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    // Act
+    auto destroyed = std::async(std::launch::async, [&reader]() { reader.reset(); });
+    const bool stopped = destroyed.wait_for(std::chrono::seconds(5)) == std::future_status::ready;
+    // Unblock a reader that ignored the wake-up, so a failure does not hang
+    ::close(fds[1]);
+    destroyed.wait();
+    ::close(fds[0]);
+
+    // Assert
+    REQUIRE(stopped);
+}
+#endif
+
+TEST_CASE("Stream: ChunkReader - Missing File", "[stream][component]") {
+    // Arrange
+    aoc2025::ChunkReader reader("aoc2025_no_such_file.txt");
+    
+    // Act & Assert
+    REQUIRE_THROWS_AS(reader.next(), std::runtime_error);
+}
+
+} // namespace stream_tests
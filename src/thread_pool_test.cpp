@@ -0,0 +1,56 @@
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+#include "thread_pool.hpp"
+
+namespace thread_pool_tests {
+
+TEST_CASE("ThreadPool: Submit - Returns Results", "[threadpool][component]") {
+    // Arrange
+    aoc2025::ThreadPool pool(4);
+    std::vector<std::future<int>> results;
+    
+    // Act
+    for (int i = 0; i < 100; ++i) {
+        results.push_back(pool.submit([i]() { return i * i; }));
+    }
+    
+    // Assert
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(results[i].get() == i * i);
+    }
+}
+
+TEST_CASE("ThreadPool: Submit - Propagates Exceptions", "[threadpool][component]") {
+    // Arrange
+    aoc2025::ThreadPool pool(2);
+    
+    // Act
+    auto result = pool.submit([]() -> int { throw std::invalid_argument("bad input"); });
+    
+    // Assert
+    REQUIRE_THROWS_AS(result.get(), std::invalid_argument);
+}
+
+TEST_CASE("ThreadPool: Destructor - Drains Nested Tasks", "[threadpool][component]") {
+    // Arrange
+    std::atomic<int> count = 0;
+    
+    // Act
+    {
+        aoc2025::ThreadPool pool(1);
+        for (int i = 0; i < 10; ++i) {
+            pool.submit([&pool, &count]() {
+                ++count;
+                pool.submit([&count]() { ++count; });
+            });
+        }
+    }
+    
+    // Assert
+    REQUIRE(count == 20);
+}
+
+} // namespace thread_pool_tests
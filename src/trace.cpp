@@ -0,0 +1,134 @@
+#include "trace.hpp"
+
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace aoc2025::trace {
+    namespace {
+        struct Event {
+            const char* name;
+            char phase;  // 'X' complete zone, 'C' counter, 'M' thread name
+            std::uint64_t start_ns;
+            std::uint64_t duration_ns;
+            std::int64_t value;
+        };
+
+        // Events are appended to a per-thread buffer under that buffer's own
+        // mutex, which only the exporter ever contends, so taking it costs an
+        // uncontended lock. Buffers are owned by the registry so they outlive
+        // their threads.
+        struct ThreadBuffer {
+            std::uint32_t thread_id;
+            std::mutex mutex;  // only contended while exporting or clearing
+            std::vector<Event> events;
+        };
+
+        std::atomic<bool> g_enabled = false;
+        const std::chrono::steady_clock::time_point g_epoch = std::chrono::steady_clock::now();
+
+        std::mutex g_registry_mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> g_buffers;
+
+        ThreadBuffer& local_buffer() {
+            thread_local ThreadBuffer* buffer = nullptr;
+            if (buffer == nullptr) {
+                std::lock_guard lock(g_registry_mutex);
+                g_buffers.push_back(std::make_unique<ThreadBuffer>());
+                buffer = g_buffers.back().get();
+                buffer->thread_id = static_cast<std::uint32_t>(g_buffers.size());
+                buffer->events.reserve(1024);
+            }
+            return *buffer;
+        }
+
+        void push(const Event& event) {
+            ThreadBuffer& buffer = local_buffer();
+            std::lock_guard lock(buffer.mutex);
+            buffer.events.push_back(event);
+        }
+
+        void write_escaped(std::ostream& out, const char* text) {
+            for (; *text != '\0'; ++text) {
+                if (*text == '"' || *text == '\\') {
+                    out << '\\';
+                }
+                out << *text;
+            }
+        }
+    }
+
+    void set_enabled(bool enabled) {
+        g_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool enabled() {
+        return g_enabled.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t now_ns() {
+        // Offset by one so a valid timestamp is never zero
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - g_epoch).count()) + 1;
+    }
+
+    void complete(const char* name, std::uint64_t start_ns, std::uint64_t end_ns, std::int64_t arg) {
+        push(Event{name, 'X', start_ns, end_ns - start_ns, arg});
+    }
+
+    void counter(const char* name, std::int64_t value) {
+        push(Event{name, 'C', now_ns(), 0, value});
+    }
+
+    void thread_name(const char* name) {
+        push(Event{name, 'M', 0, 0, 0});
+    }
+
+    bool write_chrome_json(const std::string& path) {
+        std::ofstream out(path);
+        if (!out.is_open()) {
+            return false;
+        }
+        out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n";
+        out << std::fixed << std::setprecision(3);
+        bool first = true;
+        std::lock_guard registry_lock(g_registry_mutex);
+        for (const auto& buffer : g_buffers) {
+            std::lock_guard lock(buffer->mutex);
+            for (const Event& event : buffer->events) {
+                out << (first ? "" : ",\n") << "{\"name\": \"";
+                first = false;
+                if (event.phase == 'M') {
+                    out << "thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << buffer->thread_id
+                        << ", \"args\": {\"name\": \"";
+                    write_escaped(out, event.name);
+                    out << "\"}}";
+                    continue;
+                }
+                write_escaped(out, event.name);
+                out << "\", \"ph\": \"" << event.phase << "\", \"pid\": 1, \"tid\": " << buffer->thread_id
+                    << ", \"ts\": " << static_cast<double>(event.start_ns) / 1e3;
+                if (event.phase == 'X') {
+                    out << ", \"dur\": " << static_cast<double>(event.duration_ns) / 1e3;
+                }
+                if (event.phase == 'C' || event.value >= 0) {
+                    out << ", \"args\": {\"value\": " << event.value << "}";
+                }
+                out << "}";
+            }
+        }
+        out << "\n]}\n";
+        return out.good();
+    }
+
+    void clear() {
+        std::lock_guard registry_lock(g_registry_mutex);
+        for (const auto& buffer : g_buffers) {
+            std::lock_guard lock(buffer->mutex);
+            buffer->events.clear();
+        }
+    }
+}
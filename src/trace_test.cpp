@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "trace.hpp"
+
+namespace trace_tests {
+
+static std::string read_file(const std::filesystem::path& path) {
+    std::ifstream file(path);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+TEST_CASE("Trace: Zone - Disabled Records Nothing", "[trace][component]") {
+    // Arrange
+    const auto path = std::filesystem::temp_directory_path() / "aoc2025_trace_disabled.json";
+    aoc2025::trace::clear();
+    aoc2025::trace::set_enabled(false);
+    
+    // Act
+    {
+        aoc2025::trace::Zone zone("test/disabled");
+    }
+    aoc2025::trace::write_chrome_json(path.string());
+    
+    // Assert
+    REQUIRE(read_file(path).find("test/disabled") == std::string::npos);
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Trace: Export - Chrome JSON Events", "[trace][component]") {
+    // Arrange
+    const auto path = std::filesystem::temp_directory_path() / "aoc2025_trace_enabled.json";
+    aoc2025::trace::clear();
+    aoc2025::trace::set_enabled(true);
+    
+    // Act
+    {
+        aoc2025::trace::Zone zone("test/zone", 3);
+        aoc2025::trace::counter("test/counter", 42);
+    }
+    aoc2025::trace::set_enabled(false);
+    const bool written = aoc2025::trace::write_chrome_json(path.string());
+    const std::string json = read_file(path);
+    
+    // Assert
+    REQUIRE(written);
+    REQUIRE(json.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(json.find("{\"name\": \"test/zone\", \"ph\": \"X\"") != std::string::npos);
+    REQUIRE(json.find("\"args\": {\"value\": 3}") != std::string::npos);
+    REQUIRE(json.find("{\"name\": \"test/counter\", \"ph\": \"C\"") != std::string::npos);
+    REQUIRE(json.find("\"args\": {\"value\": 42}") != std::string::npos);
+    aoc2025::trace::clear();
+    std::filesystem::remove(path);
+}
+
+} // namespace trace_tests
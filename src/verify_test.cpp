@@ -0,0 +1,331 @@
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "day1.hpp"
+#include "day2.hpp"
+#include "day3.hpp"
+#include "verify.hpp"
+
+// Differential checks of the optimized solvers against the reference
+// oracles kept in DayN::reference, on fixed adversarial cases plus seeded
+// random ones. Set AOC2025_VERIFY_ITERATIONS for a longer soak.
+namespace verify_tests {
+
+constexpr std::uint64_t kSeed = 2025;
+
+template <typename T>
+static std::string join(const std::vector<T>& items) {
+    std::ostringstream out;
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        out << (i == 0 ? "" : ",") << items[i];
+    }
+    return out.str();
+}
+
+template <typename Mismatch>
+static void require_no_mismatch(const Mismatch& mismatch) {
+    if (mismatch) {
+        INFO("seed " << mismatch->seed << ", minimized input: " << join(mismatch->input));
+        INFO("fast " << mismatch->fast << " vs oracle " << mismatch->oracle);
+        FAIL("fast implementation disagrees with the oracle");
+    }
+}
+
+TEST_CASE("Verify: minimize - Reduces To The Failing Core", "[verify][component]") {
+    // Arrange
+    const std::vector<int> input{1, 2, 3, 4, 5, 6, 7, 8};
+    auto fails = [](const std::vector<int>& candidate) {
+        return std::count(candidate.begin(), candidate.end(), 3) > 0 && std::count(candidate.begin(), candidate.end(), 7) > 0;
+    };
+    
+    // Act
+    const auto minimal = aoc2025::verify::minimize(input, fails);
+    
+    // Assert
+    REQUIRE(minimal == std::vector<int>{3, 7});
+}
+
+TEST_CASE("Verify: minimize - Shrinks Elements", "[verify][component]") {
+    // Arrange
+    auto fails = [](const std::vector<int>& candidate) { return candidate.size() == 1 && candidate[0] >= 10; };
+    auto halve = [](int value) { return value > 0 ? std::vector<int>{value / 2, value - 1} : std::vector<int>{}; };
+    
+    // Act
+    const auto minimal = aoc2025::verify::minimize(std::vector<int>{1000}, fails, halve);
+    
+    // Assert
+    REQUIRE(minimal == std::vector<int>{10});
+}
+
+// Day 1: rotations as tokens such as "L68", run on dials of several sizes
+namespace day1 {
+    std::int64_t fast(const std::vector<std::string>& tokens, std::uint8_t max) {
+        Day1::Dial dial;
+        dial.max = max;
+        dial.position = std::min<std::uint8_t>(50, max);
+        Day1::DialCounter counter(dial, Day1::CountMode::kCountPass);
+        for (const auto& token : tokens) {
+            dial.rotate(Day1::DialRotation(token));
+        }
+        return counter.get_count();
+    }
+
+    std::int64_t oracle(const std::vector<std::string>& tokens, std::uint8_t max) {
+        const int range_size = max + 1;
+        int position = std::min(50, static_cast<int>(max));
+        std::int64_t count = 0;
+        for (const auto& token : tokens) {
+            const Day1::DialRotation rotation(token);
+            count += Day1::reference::count_passes(position, 0, max, rotation);
+            position = ((position + static_cast<int>(rotation.direction) * rotation.steps) % range_size + range_size) % range_size;
+        }
+        return count;
+    }
+
+    std::vector<std::string> shrink(const std::string& token) {
+        const int steps = std::stoi(token.substr(1));
+        std::vector<std::string> smaller;
+        if (steps > 1) {
+            smaller.push_back(token.substr(0, 1) + std::to_string(steps / 2));
+            smaller.push_back(token.substr(0, 1) + std::to_string(steps - 1));
+        }
+        if (token[0] == 'L') {
+            smaller.push_back("R" + token.substr(1));
+        }
+        return smaller;
+    }
+}
+
+TEST_CASE("Verify: Day 1 - Arithmetic Pass Counting Matches Stepping", "[verify][day1]") {
+    // Arrange: exact hits, full laps and leaving or returning to zero
+    const std::vector<std::vector<std::string>> fixed{
+        {"L50"}, {"R50"}, {"L50", "L1"}, {"L50", "R1"}, {"L50", "L100"}, {"L50", "R100"},
+        {"R150"}, {"L150"}, {"R255"}, {"L255"}, {"L50", "L255", "R255"}, {"R49", "R1", "R100", "L100"},
+        {"R1000"}, {"L1000"}, {"L65535"}, {"L50", "R65535", "L999"},
+    };
+    auto generate = [](aoc2025::gen::Random& random) {
+        std::vector<std::string> tokens(random.between(1, 40));
+        for (auto& token : tokens) {
+            // Appended rather than const char* + std::string, which trips GCC 12's -Wrestrict
+            token.assign(1, random.next() & 1 ? 'L' : 'R');
+            token += std::to_string(random.between(1, 3000));
+        }
+        return tokens;
+    };
+    
+    for (const std::uint8_t max : {std::uint8_t{99}, std::uint8_t{0}, std::uint8_t{1}, std::uint8_t{6}, std::uint8_t{255}}) {
+        // Act
+        const auto mismatch = aoc2025::verify::find_mismatch<std::string>(
+            fixed, kSeed, aoc2025::verify::iterations(300), generate,
+            [max](const auto& tokens) { return day1::fast(tokens, max); },
+            [max](const auto& tokens) { return day1::oracle(tokens, max); },
+            day1::shrink);
+        
+        // Assert
+        INFO("dial 0.." << static_cast<int>(max));
+        require_no_mismatch(mismatch);
+    }
+}
+
+// Day 2: single IDs and "start-end" range tokens
+namespace day2 {
+    std::vector<std::int64_t> adversarial_ids() {
+        std::vector<std::int64_t> ids{0, 1, 9, 10, 11, 99, 100, 1010, 1111, 1212, 123123, 121212, 1234512345,
+                                      std::numeric_limits<std::int64_t>::max()};
+        for (std::int64_t power = 10; power < std::numeric_limits<std::int64_t>::max() / 10; power *= 10) {
+            for (const std::int64_t delta : {-2, -1, 0, 1, 2}) {
+                ids.push_back(power + delta);
+            }
+            ids.push_back(power * 10 / 9);  // all ones
+            ids.push_back(power * 10 - 1);  // all nines
+        }
+        return ids;
+    }
+
+    std::string render_ids(const std::vector<std::int64_t>& ids, std::optional<std::int64_t> (*check)(std::int64_t)) {
+        std::string out;
+        for (const std::int64_t id : ids) {
+            out += check(id) ? '1' : '0';
+        }
+        return out;
+    }
+
+    std::int64_t fast_sum(const std::vector<std::string>& tokens, int part) {
+        std::int64_t sum = 0;
+        for (const auto& token : tokens) {
+            const Day2::Range range(token);
+            sum += part == 1 ? Day2::detail::sum_part1(range) : Day2::detail::sum_part2(range);
+        }
+        return sum;
+    }
+
+    std::int64_t oracle_sum(const std::vector<std::string>& tokens, int part) {
+        std::int64_t sum = 0;
+        for (const auto& token : tokens) {
+            const Day2::Range range(token);
+            sum += part == 1 ? Day2::reference::sum_range(range, Day2::reference::part1_id_of_concern)
+                             : Day2::reference::sum_range(range, Day2::reference::part2_id_of_concern);
+        }
+        return sum;
+    }
+
+    std::string range_around(std::int64_t center, std::int64_t below, std::int64_t above) {
+        return std::to_string(std::max<std::int64_t>(center - below, 0)) + "-" + std::to_string(center + above);
+    }
+
+    std::vector<std::string> shrink(const std::string& token) {
+        const Day2::Range range(token);
+        std::vector<std::string> smaller;
+        if (range.end > range.start) {
+            const std::int64_t mid = range.start + (range.end - range.start) / 2;
+            smaller.push_back(std::to_string(range.start) + "-" + std::to_string(mid));
+            smaller.push_back(std::to_string(mid + 1) + "-" + std::to_string(range.end));
+            smaller.push_back(std::to_string(range.start + 1) + "-" + std::to_string(range.end));
+            smaller.push_back(std::to_string(range.start) + "-" + std::to_string(range.end - 1));
+        }
+        return smaller;
+    }
+}
+
+TEST_CASE("Verify: Day 2 - Arithmetic ID Checks Match String Checks", "[verify][day2]") {
+    // Arrange
+    const std::vector<std::vector<std::int64_t>> fixed{day2::adversarial_ids()};
+    auto generate = [](aoc2025::gen::Random& random) {
+        std::vector<std::int64_t> ids(64);
+        for (auto& id : ids) {
+            const auto digits = random.between(1, 18);
+            std::int64_t block = static_cast<std::int64_t>(random.between(1, 999));
+            if (random.next() & 1) {
+                // Repeat a short block to hit IDs of concern often
+                std::string text;
+                while (text.size() < digits) {
+                    text += std::to_string(block);
+                }
+                id = std::stoll(text.substr(0, 18));
+            } else {
+                std::int64_t limit = 1;
+                for (std::uint64_t d = 0; d < digits; ++d) {
+                    limit *= 10;
+                }
+                id = static_cast<std::int64_t>(random.between(0, static_cast<std::uint64_t>(limit - 1)));
+            }
+        }
+        return ids;
+    };
+    
+    // Act
+    const auto part1 = aoc2025::verify::find_mismatch<std::int64_t>(
+        fixed, kSeed, aoc2025::verify::iterations(300), generate,
+        [](const auto& ids) { return day2::render_ids(ids, Day2::Part1IdOfConcern); },
+        [](const auto& ids) { return day2::render_ids(ids, Day2::reference::part1_id_of_concern); },
+        [](std::int64_t) { return std::vector<std::int64_t>{}; });
+    const auto part2 = aoc2025::verify::find_mismatch<std::int64_t>(
+        fixed, kSeed, aoc2025::verify::iterations(300), generate,
+        [](const auto& ids) { return day2::render_ids(ids, Day2::Part2IdOfConcern); },
+        [](const auto& ids) { return day2::render_ids(ids, Day2::reference::part2_id_of_concern); },
+        [](std::int64_t) { return std::vector<std::int64_t>{}; });
+    
+    // Assert
+    require_no_mismatch(part1);
+    require_no_mismatch(part2);
+}
+
+TEST_CASE("Verify: Day 2 - Closed-Form Range Sums Match Enumeration", "[verify][day2]") {
+    // Arrange: ranges across digit-length transitions and around repeated patterns
+    std::vector<std::vector<std::string>> fixed{
+        {"0-0"}, {"0-100"}, {"1-9"}, {"11-11"}, {"10-12"}, {"95-115"}, {"998-1012"}, {"1188511880-1188511890"},
+        {"222220-222224"}, {"2121212118-2121212124"}, {"111110-111112"}, {"999999-1000011"},
+        {"999999999999999990-1000000000000000010"}, {"9223372036854775000-9223372036854775806"},
+    };
+    for (std::int64_t power = 10; power <= 1000000000000000000; power *= 10) {
+        fixed.push_back({day2::range_around(power, 600, 600)});
+        if (power < 1000000000000000000) {
+            fixed.push_back({day2::range_around(power * 10 / 9, 300, 300)});
+        }
+    }
+    auto generate = [](aoc2025::gen::Random& random) {
+        std::vector<std::string> tokens(random.between(1, 4));
+        for (auto& token : tokens) {
+            std::int64_t center = 1;
+            for (auto d = random.between(1, 18); d > 0; --d) {
+                center = center * 10 + static_cast<std::int64_t>(random.between(0, 9));
+            }
+            token = day2::range_around(center, static_cast<std::int64_t>(random.between(0, 500)),
+                                       static_cast<std::int64_t>(random.between(0, 500)));
+        }
+        return tokens;
+    };
+    
+    for (const int part : {1, 2}) {
+        // Act
+        const auto mismatch = aoc2025::verify::find_mismatch<std::string>(
+            fixed, kSeed, aoc2025::verify::iterations(200), generate,
+            [part](const auto& tokens) { return day2::fast_sum(tokens, part); },
+            [part](const auto& tokens) { return day2::oracle_sum(tokens, part); },
+            day2::shrink);
+        
+        // Assert
+        INFO("part " << part);
+        require_no_mismatch(mismatch);
+    }
+}
+
+// Day 3: a bank as a list of digit characters
+namespace day3 {
+    std::string fast(const std::vector<char>& digits, std::size_t n) {
+        const Day3::Bank bank(std::string(digits.begin(), digits.end()));
+        return std::to_string(bank.max_n(n)) + "/" + std::to_string(bank.max_pair());
+    }
+
+    std::string oracle(const std::vector<char>& digits, std::size_t n) {
+        const Day3::Bank bank(std::string(digits.begin(), digits.end()));
+        return std::to_string(Day3::reference::max_n(bank, n)) + "/" + std::to_string(Day3::reference::max_n(bank, 2));
+    }
+
+    std::vector<char> shrink(char digit) {
+        return digit > '0' ? std::vector<char>{'0', static_cast<char>(digit - 1)} : std::vector<char>{};
+    }
+
+    std::vector<char> digits_of(const std::string& text) {
+        return {text.begin(), text.end()};
+    }
+}
+
+TEST_CASE("Verify: Day 3 - Greedy max_n Matches Recursive Search", "[verify][day3]") {
+    // Arrange: ties, monotone runs and lengths around n
+    const std::vector<std::vector<char>> fixed{
+        day3::digits_of("9"), day3::digits_of("99999999999999999"), day3::digits_of("11111111111111111111"),
+        day3::digits_of("123456789123456789"), day3::digits_of("987654321987654321"),
+        day3::digits_of("000000000000"), day3::digits_of("00000000000"), day3::digits_of("1000000000001"),
+        day3::digits_of("818181911112111"), day3::digits_of("234234234234278"), day3::digits_of("11112222333344445555"),
+    };
+    auto generate = [](aoc2025::gen::Random& random) {
+        // Few distinct digits make ties, which is where greedy choices go wrong
+        const auto alphabet = random.between(1, 10);
+        const auto low = random.between(0, 10 - alphabet);
+        std::vector<char> digits(random.between(1, 40));
+        for (auto& digit : digits) {
+            digit = static_cast<char>('0' + random.between(low, low + alphabet - 1));
+        }
+        return digits;
+    };
+    
+    for (const std::size_t n : {std::size_t{1}, std::size_t{2}, std::size_t{3}, std::size_t{12}, std::size_t{18}}) {
+        // Act
+        const auto mismatch = aoc2025::verify::find_mismatch<char>(
+            fixed, kSeed, aoc2025::verify::iterations(500), generate,
+            [n](const auto& digits) { return day3::fast(digits, n); },
+            [n](const auto& digits) { return day3::oracle(digits, n); },
+            day3::shrink);
+        
+        // Assert
+        INFO("n = " << n);
+        require_no_mismatch(mismatch);
+    }
+}
+
+} // namespace verify_tests
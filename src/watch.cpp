@@ -0,0 +1,141 @@
+#include "watch.hpp"
+
+#include <atomic>
+#include <csignal>
+#include <iomanip>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+#include "trace.hpp"
+
+namespace aoc2025 {
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        double elapsed_ms(Clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        volatile std::sig_atomic_t stop_requested = 0;
+
+        void stop_on_signal(int) {
+            stop_requested = 1;
+        }
+    }
+
+    Watcher::Watcher(std::vector<Target> targets) {
+        for (Target& target : targets) {
+            if (!target.day->has_incremental()) {
+                throw std::invalid_argument("Day " + std::to_string(target.day->day_number) +
+                                            " has no incremental solver");
+            }
+            auto solver = target.day->incremental();
+            watched_.push_back({std::move(target), std::move(solver), std::nullopt});
+        }
+    }
+
+    std::vector<Watcher::Update> Watcher::poll() {
+        std::vector<Update> updates;
+        for (Watched& watched : watched_) {
+            std::error_code error;
+            const std::uintmax_t size = std::filesystem::file_size(watched.target.path, error);
+            const auto modified = std::filesystem::last_write_time(watched.target.path, error);
+            if (error || (watched.seen && watched.seen->first == size && watched.seen->second == modified)) {
+                continue;
+            }
+            // Recorded before reading, so a file that fails is retried only
+            // once it changes again
+            watched.seen.emplace(size, modified);
+
+            const Day& day = *watched.target.day;
+            AOC2025_TRACE_ZONE("watch/update", day.day_number);
+            Update update;
+            update.day_number = day.day_number;
+            try {
+                const auto read_start = Clock::now();
+                const Input input = Input::open(watched.target.path.string());
+                update.read_ms = elapsed_ms(read_start);
+                const auto solve_start = Clock::now();
+                update.records = watched.solver->update(input.view());
+                update.solve_ms = elapsed_ms(solve_start);
+            } catch (const std::exception& failure) {
+                update.error = failure.what();
+                // A solver that threw may be left partway through the edit, so
+                // the next good version is solved from scratch
+                watched.solver = day.incremental();
+            }
+            for (int part = 1; part <= 2; ++part) {
+                update.unlocked[part - 1] = day.has_part(part);
+                if (update.unlocked[part - 1] && update.error.empty()) {
+                    update.answers[part - 1] = watched.solver->answer(part);
+                }
+            }
+            updates.push_back(std::move(update));
+        }
+        return updates;
+    }
+
+    void print_update(std::ostream& out, std::ostream& err, const Watcher::Update& update, bool show_timings) {
+        if (!update.error.empty()) {
+            err << "Day " << update.day_number << ": " << update.error << '\n';
+        }
+        out << "Day " << update.day_number << ":\n";
+        for (int part = 1; part <= 2; ++part) {
+            if (!update.unlocked[part - 1]) {
+                out << "  Part " << part << ": Not yet unlocked\n";
+            } else if (update.answers[part - 1]) {
+                out << "  Part " << part << ": " << *update.answers[part - 1] << '\n';
+            } else {
+                out << "  Part " << part << ": failed\n";
+            }
+        }
+        if (show_timings && update.error.empty()) {
+            out << "  Update: " << update.records << " records re-solved in " << std::fixed << std::setprecision(3)
+                << update.solve_ms << " ms (read " << update.read_ms << " ms)\n";
+        }
+        out << '\n' << std::flush;
+    }
+
+    int watch(const WatchOptions& options, std::ostream& out, std::ostream& err) {
+        std::vector<Watcher::Target> targets;
+        if (options.days.empty()) {
+            for (const auto& [day_number, day] : days) {
+                if (day.has_incremental() && day.has_input()) {
+                    targets.push_back({&day, day.get_input_file()});
+                }
+            }
+        } else {
+            for (const int day_number : options.days) {
+                const auto it = days.find(day_number);
+                if (it == days.end()) {
+                    err << "Day " << day_number << " not implemented yet\n";
+                    return 1;
+                }
+                if (!it->second.has_incremental()) {
+                    err << "Day " << day_number << " cannot be watched\n";
+                    return 1;
+                }
+                targets.push_back({&it->second, it->second.get_input_file()});
+            }
+        }
+        if (targets.empty()) {
+            err << "No inputs to watch\n";
+            return 1;
+        }
+
+        Watcher watcher(std::move(targets));
+        stop_requested = 0;
+        std::signal(SIGINT, stop_on_signal);
+        std::signal(SIGTERM, stop_on_signal);
+        while (stop_requested == 0) {
+            for (const Watcher::Update& update : watcher.poll()) {
+                print_update(out, err, update, options.show_timings);
+            }
+            std::this_thread::sleep_for(options.interval);
+        }
+        std::signal(SIGINT, SIG_DFL);
+        std::signal(SIGTERM, SIG_DFL);
+        return 0;
+    }
+}